@@ -0,0 +1,186 @@
+// vim: sw=2 ts=2 expandtab smartindent
+
+/**
+ * turn the joint positions export_joints.py samples out of the FBXs into a
+ * header containing an animdata_Clip, with every key that can be lerped
+ * back to within ERROR_TOLERANCE removed
+ **/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <dirent.h>
+#include <math.h>
+
+/* keep in sync with animdata_JointKey */
+#define JOINT_COUNT 15
+#define CHANNEL_COUNT (JOINT_COUNT * 3)
+
+/* in meters; a removed key is never reconstructed further than this from where it was */
+#define ERROR_TOLERANCE 0.001f
+
+#define QUANT_MAX 65535.0f
+
+typedef struct {
+  float time;
+  float pos[CHANNEL_COUNT];
+} Frame;
+
+/* how far the frames between lhs and rhs are from where lerping lhs to rhs would put them */
+static int span_fits(Frame *frames, int lhs, int rhs) {
+  for (int i = lhs + 1; i < rhs; i++) {
+    float t = (frames[i].time - frames[lhs].time) / (frames[rhs].time - frames[lhs].time);
+
+    for (int j = 0; j < JOINT_COUNT; j++) {
+      float d2 = 0.0f;
+      for (int axis = 0; axis < 3; axis++) {
+        float a = frames[lhs].pos[j*3 + axis];
+        float b = frames[rhs].pos[j*3 + axis];
+        float d = a + (b - a)*t - frames[i].pos[j*3 + axis];
+        d2 += d*d;
+      }
+      if (d2 > ERROR_TOLERANCE*ERROR_TOLERANCE) return 0;
+    }
+  }
+  return 1;
+}
+
+int cook(char *file_name) {
+  Frame *frames = NULL;
+  int frame_count = 0;
+  float duration = 0.0f;
+
+  /* read joints/name.txt */
+  {
+    char buf[999] = {0};
+    snprintf(buf, sizeof(buf), "./joints/%s.txt", file_name);
+    FILE *file = fopen(buf, "r");
+    if (file == NULL) { perror("Failed to open joints file"); return 1; }
+
+    static char line[1 << 16];
+    while (fgets(line, sizeof(line), file)) {
+      if (strncmp(line, "duration ", 9) == 0) duration = strtof(line + 9, NULL);
+
+      if (strncmp(line, "frame ", 6) == 0) {
+        frames = realloc(frames, sizeof(Frame) * (frame_count + 1));
+        Frame *f = frames + frame_count++;
+
+        char *word = line + 6;
+        f->time = strtof(word, &word);
+        for (int i = 0; i < CHANNEL_COUNT; i++) {
+          char *end;
+          f->pos[i] = strtof(word, &end);
+          if (end == word) { fprintf(stderr, "frame %d is missing joints\n", frame_count - 1); return 1; }
+          word = end;
+        }
+      }
+    }
+    fclose(file);
+  }
+
+  if (frame_count < 2 || duration <= 0.0f) { fprintf(stderr, "%s has no animation in it\n", file_name); return 1; }
+
+  /* Greedy keyframe reduction: from each kept key, reach as far forward as possible while
+   * every frame skipped over lerps back into tolerance. Every joint shares the same key
+   * times, so a key only goes if every joint can do without it. The first and last
+   * frames always stay; the runtime tweens the last one back into the first. */
+  int *keep = malloc(sizeof(int) * frame_count);
+  int key_count = 0;
+  {
+    int lhs = 0;
+    keep[key_count++] = 0;
+    while (lhs < frame_count - 1) {
+      int rhs = lhs + 1;
+      while (rhs + 1 < frame_count && span_fits(frames, lhs, rhs + 1)) rhs++;
+      keep[key_count++] = rhs;
+      lhs = rhs;
+    }
+  }
+
+  /* quantization range */
+  float min[3] = {  INFINITY,  INFINITY,  INFINITY };
+  float max[3] = { -INFINITY, -INFINITY, -INFINITY };
+  for (int k = 0; k < key_count; k++)
+    for (int i = 0; i < CHANNEL_COUNT; i++) {
+      min[i % 3] = fminf(min[i % 3], frames[keep[k]].pos[i]);
+      max[i % 3] = fmaxf(max[i % 3], frames[keep[k]].pos[i]);
+    }
+  float extent[3] = { max[0] - min[0], max[1] - min[1], max[2] - min[2] };
+
+  FILE *out;
+  {
+    char buf[999] = {0};
+    snprintf(buf, sizeof(buf), "./include/%s.h", file_name);
+    out = fopen(buf, "w");
+    if (out == NULL) { perror("Failed to create .h file"); return 1; }
+  }
+
+  fprintf(out, "/* cooked by anim_cooker from joints/%s.txt: %d of %d keys kept at %gm tolerance */\n\n",
+          file_name, key_count, frame_count, ERROR_TOLERANCE);
+
+  fprintf(out, "float animdata_%s_key_times[] = {", file_name);
+  for (int k = 0; k < key_count; k++)
+    fprintf(out, "%s%.9g,", (k % 8) ? " " : "\n  ", frames[keep[k]].time);
+  fprintf(out, "\n};\n\n");
+
+  static const char *axes = "xyz";
+  fprintf(out, "uint16_t animdata_%s_keys[] = {\n", file_name);
+  for (int i = 0; i < CHANNEL_COUNT; i++) {
+    fprintf(out, "  /* joint %2d %c */", i / 3, axes[i % 3]);
+    for (int k = 0; k < key_count; k++) {
+      float t = (extent[i % 3] > 0.0f) ? (frames[keep[k]].pos[i] - min[i % 3]) / extent[i % 3] : 0.0f;
+      fprintf(out, " %5d,", (int)roundf(t * QUANT_MAX));
+    }
+    fprintf(out, "\n");
+  }
+  fprintf(out, "};\n\n");
+
+  fprintf(out, "animdata_Clip animdata_%s_clip = {\n", file_name);
+  fprintf(out, "  .duration  = %.9g,\n", duration);
+  fprintf(out, "  .key_count = %d,\n", key_count);
+  fprintf(out, "  .key_times = animdata_%s_key_times,\n", file_name);
+  fprintf(out, "  .min       = { %.9g, %.9g, %.9g },\n", min[0], min[1], min[2]);
+  fprintf(out, "  .extent    = { %.9g, %.9g, %.9g },\n", extent[0], extent[1], extent[2]);
+  fprintf(out, "  .keys      = animdata_%s_keys,\n", file_name);
+  fprintf(out, "};\n");
+
+  printf("%d of %d keys kept\n", key_count, frame_count);
+
+  free(keep);
+  free(frames);
+  fclose(out);
+
+  return 0;
+}
+
+int main(int n_args, char **args) {
+  if (n_args == 1) {
+    puts("No argument provided, cooking joints/* ...");
+
+    DIR *dir = opendir("./joints/");
+    struct dirent *entry;
+    if (dir == NULL) { perror("opendir ./joints/"); return 1; }
+
+    while ((entry = readdir(dir)) != NULL) {
+        if (entry->d_name[0] == '.') continue;
+
+        strtok(entry->d_name, ".");
+        printf("Cooking ./joints/%s.txt into ./include/%s.h ... \n", entry->d_name, entry->d_name);
+        if (cook(entry->d_name)) return 1;
+    }
+
+    closedir(dir);
+    puts("done!");
+    return 0;
+  }
+
+  if (n_args == 2) {
+    strtok(args[1], ".");
+    printf("Cooking ./joints/%s.txt into ./include/%s.h ... \n", args[1], args[1]);
+    return cook(args[1]);
+  }
+
+  perror("Supported number of arguments: 0, 1");
+  return 0;
+}
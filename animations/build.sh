@@ -0,0 +1,5 @@
+mkdir -p build
+cd build
+gcc ../anim_cooker.c -g -Werror -fsanitize=address -o anim_cooker -lm || { exit 1; }
+cd ..
+./build/anim_cooker
@@ -0,0 +1,61 @@
+# run with: blender --background --python export_joints.py
+#
+# imports each of the Mixamo FBXs in this folder and writes the world-space
+# position of every joint the game cares about, every frame, into joints/
+# (anim_cooker turns those into include/*.h)
+
+import bpy
+import os
+
+FPS = 24
+
+# same order as animdata_JointKey
+JOINTS = [
+    "Hips",
+    "RightArm", "RightForeArm", "RightHand",
+    "Neck", "Head",
+    "LeftArm", "LeftForeArm", "LeftHand",
+    "RightLeg", "RightToeBase", "RightToe_End",
+    "LeftLeg", "LeftToeBase", "LeftToe_End",
+]
+
+# the clips that were cooked before this script existed keep their names
+NAMES = {
+    "Walking.fbx":       "walk",
+    "Left Turn 90.fbx":  "turn90_left",
+    "Right Turn 90.fbx": "turn90_right",
+}
+
+here = os.path.dirname(os.path.abspath(__file__))
+os.makedirs(os.path.join(here, "joints"), exist_ok=True)
+
+for fbx in sorted(os.listdir(here)):
+    if not fbx.endswith(".fbx"): continue
+    name = NAMES.get(fbx, fbx[:-len(".fbx")].lower().replace(" ", "_"))
+
+    bpy.ops.wm.read_factory_settings(use_empty=True)
+    bpy.ops.import_scene.fbx(filepath=os.path.join(here, fbx))
+
+    scene = bpy.context.scene
+    scene.render.fps = FPS
+    arm = next(o for o in scene.objects if o.type == 'ARMATURE')
+    action = arm.animation_data.action
+    first, last = (int(f) for f in action.frame_range)
+
+    def bone(joint):
+        return arm.pose.bones.get("mixamorig:" + joint) or arm.pose.bones[joint]
+
+    with open(os.path.join(here, "joints", name + ".txt"), "w") as out:
+        out.write("# %s, sampled at %dfps by export_joints.py\n" % (fbx, FPS))
+        out.write("duration %r\n" % ((last - first + 1) / FPS))
+        out.write("joints %s\n" % " ".join(JOINTS))
+
+        for frame in range(first, last + 1):
+            scene.frame_set(frame)
+            pos = []
+            for joint in JOINTS:
+                p = arm.matrix_world @ bone(joint).head
+                pos += [p.x, p.y, p.z]
+            out.write("frame %r %s\n" % ((frame - first) / FPS, " ".join(repr(v) for v in pos)))
+
+    print("exported %s -> joints/%s.txt" % (fbx, name))
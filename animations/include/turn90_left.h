@@ -1,377 +1,64 @@
-float animdata_turn90_left_duration = 0.9166666865348816;
-animdata_Frame animdata_turn90_left_frames[] = {
-  { .time = 0, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.0030425670742988587, -0.014877473115921021, 1.026375274658203 },
-    [animdata_JointKey_RightArm    ] = { -0.13930984185710735, 0.04250869374751925, 1.3898436390257851 },
-    [animdata_JointKey_RightForeArm] = { -0.18194928633070942, 0.03391706302084541, 1.1148473342832501 },
-    [animdata_JointKey_RightHand   ] = { -0.20314619102558376, 0.0006550822190845018, 0.8343185172713302 },
-    [animdata_JointKey_Neck        ] = { 0.004693801082870342, 0.03263302214719173, 1.4867734919982514 },
-    [animdata_JointKey_Head        ] = { -0.0029519810452270047, 0.003732142925447772, 1.5797278832671537 },
-    [animdata_JointKey_LeftArm     ] = { 0.1581933868782029, 0.016786704259025925, 1.4092274165563021 },
-    [animdata_JointKey_LeftForeArm ] = { 0.1979403224739369, 0.004377192163993236, 1.1339437457075625 },
-    [animdata_JointKey_LeftHand    ] = { 0.23357186993551415, -0.013614675078178474, 0.8534820215673382 },
-    [animdata_JointKey_RightLeg    ] = { -0.09289437538718412, -0.04748000045803319, 0.5239942538670223 },
-    [animdata_JointKey_RightToeBase] = { -0.1326552402325642, -0.055911837581473264, 0.000009446019017538277 },
-    [animdata_JointKey_RightToe_End] = { -0.1754105064762527, -0.1374110369960044, 0.011764538193054053 },
-    [animdata_JointKey_LeftLeg     ] = { 0.14629137679813467, -0.12960854937887528, 0.5292545889329244 },
-    [animdata_JointKey_LeftToeBase ] = { 0.19555028520829168, -0.18054680981123153, 0.0003791646665189319 },
-    [animdata_JointKey_LeftToe_End ] = { 0.2163832677664803, -0.27062272352932315, 0.008165730680484082 },
-  }},
-  { .time = 0.0416666679084301, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.0013486060500144958, -0.00543582558631897, 1.025283660888672 },
-    [animdata_JointKey_RightArm    ] = { -0.14881490774464592, 0.030932157707106337, 1.38883888747893 },
-    [animdata_JointKey_RightForeArm] = { -0.193202195185713, 0.026296274260724745, 1.1140240557651186 },
-    [animdata_JointKey_RightHand   ] = { -0.21231757153000494, -0.0018601779979053746, 0.8327876609641343 },
-    [animdata_JointKey_Neck        ] = { -0.005142480559157766, 0.03275295221243707, 1.4864962774653985 },
-    [animdata_JointKey_Head        ] = { -0.009668868729306154, 0.0013188416498898059, 1.5788307031515993 },
-    [animdata_JointKey_LeftArm     ] = { 0.14965656272286254, 0.033034180268402616, 1.4095766177838027 },
-    [animdata_JointKey_LeftForeArm ] = { 0.19283424534209523, 0.020348802980039837, 1.134822768139231 },
-    [animdata_JointKey_LeftHand    ] = { 0.22985474996996277, -0.001956097731192452, 0.8548512313285958 },
-    [animdata_JointKey_RightLeg    ] = { -0.09550063590879104, -0.05063367546325333, 0.5233037380333044 },
-    [animdata_JointKey_RightToeBase] = { -0.1326030122732329, -0.055981116898971894, 0.000009703161452563336 },
-    [animdata_JointKey_RightToe_End] = { -0.17535841223288695, -0.13748024318284283, 0.01176480294330438 },
-    [animdata_JointKey_LeftLeg     ] = { 0.16472599063914573, -0.11935829269185963, 0.534514106886227 },
-    [animdata_JointKey_LeftToeBase ] = { 0.19768348247070766, -0.17702855364707412, 0.0032227664551234447 },
-    [animdata_JointKey_LeftToe_End ] = { 0.22176488781978332, -0.26644747699029925, 0.008937264400645458 },
-  }},
-  { .time = 0.0833333358168602, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { -0.0033333030343055724, 0.005621415376663208, 1.0254019927978515 },
-    [animdata_JointKey_RightArm    ] = { -0.15887017428784336, 0.02173048530304607, 1.3884968095695516 },
-    [animdata_JointKey_RightForeArm] = { -0.2073797359884999, 0.020445945507645735, 1.1143434476442078 },
-    [animdata_JointKey_RightHand   ] = { -0.22615353281315448, -0.003546998878176435, 0.8326983592145982 },
-    [animdata_JointKey_Neck        ] = { -0.01662851701552216, 0.035525517352519576, 1.4870670518343827 },
-    [animdata_JointKey_Head        ] = { -0.01697179129661248, 0.001684882982460052, 1.5786581610950392 },
-    [animdata_JointKey_LeftArm     ] = { 0.13780526872952992, 0.05198914798413024, 1.4106204590384397 },
-    [animdata_JointKey_LeftForeArm ] = { 0.18636186621961925, 0.03552805211830062, 1.1369670166383303 },
-    [animdata_JointKey_LeftHand    ] = { 0.2284513030134789, 0.00653320767811441, 0.8583276904888644 },
-    [animdata_JointKey_RightLeg    ] = { -0.09841472979313276, -0.05018548327177391, 0.5233062983716112 },
-    [animdata_JointKey_RightToeBase] = { -0.1326274977524281, -0.056006710566468235, 0.000008652013846539574 },
-    [animdata_JointKey_RightToe_End] = { -0.175383170371462, -0.13750569478932823, 0.011763738549354637 },
-    [animdata_JointKey_LeftLeg     ] = { 0.1828240980909792, -0.10449542776356541, 0.5420899826193493 },
-    [animdata_JointKey_LeftToeBase ] = { 0.2033002713521632, -0.1692776388601754, 0.009486783811194091 },
-    [animdata_JointKey_LeftToe_End ] = { 0.23611881781383162, -0.25600295260106565, 0.012645396735778752 },
-  }},
-  { .time = 0.125, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { -0.010576727390289307, 0.0183380925655365, 1.027054901123047 },
-    [animdata_JointKey_RightArm    ] = { -0.16768588545148788, 0.016417067903176933, 1.3899952330792114 },
-    [animdata_JointKey_RightForeArm] = { -0.22299364797636312, 0.017217770059116216, 1.1171301926271249 },
-    [animdata_JointKey_RightHand   ] = { -0.24393771274728715, -0.0038698047908605317, 0.8354055765504859 },
-    [animdata_JointKey_Neck        ] = { -0.02737543177956666, 0.04145516601832789, 1.488996250567708 },
-    [animdata_JointKey_Head        ] = { -0.022597764499164254, 0.00569451167343944, 1.5797298559968496 },
-    [animdata_JointKey_LeftArm     ] = { 0.12482655415606918, 0.07320672969810148, 1.4122827808258251 },
-    [animdata_JointKey_LeftForeArm ] = { 0.1805246655524318, 0.05355744075588355, 1.1402046064026918 },
-    [animdata_JointKey_LeftHand    ] = { 0.2289192667432385, 0.016134799425718875, 0.863600929415927 },
-    [animdata_JointKey_RightLeg    ] = { -0.10120195270958406, -0.04427733383439449, 0.524361865549422 },
-    [animdata_JointKey_RightToeBase] = { -0.13257761526473186, -0.05601049064176337, 0.000008917325754378424 },
-    [animdata_JointKey_RightToe_End] = { -0.1753326072521921, -0.13750982954547866, 0.011764015256256113 },
-    [animdata_JointKey_LeftLeg     ] = { 0.19336671842959668, -0.07568369599380095, 0.547046523668646 },
-    [animdata_JointKey_LeftToeBase ] = { 0.22184583017592222, -0.1366413116550323, 0.011009468398663102 },
-    [animdata_JointKey_LeftToe_End ] = { 0.2738382547643581, -0.21348596174512524, 0.010970835560969512 },
-  }},
-  { .time = 0.1666666716337204, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { -0.019597647190093995, 0.03117372989654541, 1.0296142578125 },
-    [animdata_JointKey_RightArm    ] = { -0.17650298854061183, 0.014308823677335858, 1.3921542840748966 },
-    [animdata_JointKey_RightForeArm] = { -0.23914064524507442, 0.014487511086529832, 1.120876937227082 },
-    [animdata_JointKey_RightHand   ] = { -0.2629128783784158, -0.005981658348756018, 0.8393312375519749 },
-    [animdata_JointKey_Neck        ] = { -0.038858980913301505, 0.04989126630186538, 1.4916562538768852 },
-    [animdata_JointKey_Head        ] = { -0.029347138435994246, 0.013292971593262797, 1.5816802913931098 },
-    [animdata_JointKey_LeftArm     ] = { 0.10998236237261245, 0.09527341149367874, 1.4146427010141327 },
-    [animdata_JointKey_LeftForeArm ] = { 0.17496551083589304, 0.07754274001675406, 1.1444987910597182 },
-    [animdata_JointKey_LeftHand    ] = { 0.23055315168651738, 0.03028546387300309, 0.8707674257132851 },
-    [animdata_JointKey_RightLeg    ] = { -0.10394800454499403, -0.03484277037557775, 0.5259168645282456 },
-    [animdata_JointKey_RightToeBase] = { -0.1326342592907876, -0.05592736874832047, 0.000009853005713136299 },
-    [animdata_JointKey_RightToe_End] = { -0.17538933210019042, -0.13742666592240213, 0.011764959206700351 },
-    [animdata_JointKey_LeftLeg     ] = { 0.20340820287113504, -0.04092202018101948, 0.5526990078740204 },
-    [animdata_JointKey_LeftToeBase ] = { 0.2521263700762523, -0.06981783689475458, 0.011143532582883644 },
-    [animdata_JointKey_LeftToe_End ] = { 0.32958245612219667, -0.12073890599911546, 0.007154385151018595 },
-  }},
-  { .time = 0.2083333283662796, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { -0.02820512294769287, 0.04322971820831299, 1.0298160552978515 },
-    [animdata_JointKey_RightArm    ] = { -0.18261019574182286, 0.01574516978898185, 1.392372212051643 },
-    [animdata_JointKey_RightForeArm] = { -0.25345509141320355, 0.01171697558947493, 1.123151705347401 },
-    [animdata_JointKey_RightHand   ] = { -0.28118024701520894, -0.011617281882866736, 0.8421910070649546 },
-    [animdata_JointKey_Neck        ] = { -0.047809537670454594, 0.061056456509856985, 1.491865340628346 },
-    [animdata_JointKey_Head        ] = { -0.03449436890133614, 0.02496806622979186, 1.5816126081458257 },
-    [animdata_JointKey_LeftArm     ] = { 0.09697243888913107, 0.11735844709377308, 1.4137439154094158 },
-    [animdata_JointKey_LeftForeArm ] = { 0.17059827938477695, 0.107266269525537, 1.1454301205191901 },
-    [animdata_JointKey_LeftHand    ] = { 0.23304331086779784, 0.049156307109360003, 0.8752895294248857 },
-    [animdata_JointKey_RightLeg    ] = { -0.10782528254568208, -0.030681011640429752, 0.5263952785725655 },
-    [animdata_JointKey_RightToeBase] = { -0.13265398138779735, -0.055931967992438686, 0.000009960136785149843 },
-    [animdata_JointKey_RightToe_End] = { -0.17540931173874721, -0.13743112703678997, 0.01176507267451168 },
-    [animdata_JointKey_LeftLeg     ] = { 0.20612187068349985, -0.0054056315801500965, 0.5536247095617465 },
-    [animdata_JointKey_LeftToeBase ] = { 0.2625629283360573, 0.017694560297923302, 0.01053344751270318 },
-    [animdata_JointKey_LeftToe_End ] = { 0.3539816723496178, 0.0027246641724576848, 0.005353753052873753 },
-  }},
-  { .time = 0.25, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { -0.036069607734680174, 0.05474488258361816, 1.0298779296875 },
-    [animdata_JointKey_RightArm    ] = { -0.18875600853208074, 0.019062372283181386, 1.3918567669495554 },
-    [animdata_JointKey_RightForeArm] = { -0.2669272999709634, 0.009425994577339147, 1.1248150286047416 },
-    [animdata_JointKey_RightHand   ] = { -0.2968372037303273, -0.0187257888523466, 0.8445206206153572 },
-    [animdata_JointKey_Neck        ] = { -0.057395402492915616, 0.0728529494924694, 1.491810814961712 },
-    [animdata_JointKey_Head        ] = { -0.041751825277040036, 0.03794569189917452, 1.5816495567574673 },
-    [animdata_JointKey_LeftArm     ] = { 0.08353143191375899, 0.13798603203273105, 1.4128748408899592 },
-    [animdata_JointKey_LeftForeArm ] = { 0.16531578090283597, 0.14022992420612762, 1.1467523088250413 },
-    [animdata_JointKey_LeftHand    ] = { 0.23608617942391036, 0.07363575921772966, 0.8806529601759558 },
-    [animdata_JointKey_RightLeg    ] = { -0.11127930544072195, -0.026987297155458122, 0.5267559270753678 },
-    [animdata_JointKey_RightToeBase] = { -0.13266461087157774, -0.05593260590126275, 0.00000968579924743196 },
-    [animdata_JointKey_RightToe_End] = { -0.1754199283562476, -0.13743177648405017, 0.011764791778481687 },
-    [animdata_JointKey_LeftLeg     ] = { 0.19801884777468196, 0.029038287795275723, 0.5510431466896235 },
-    [animdata_JointKey_LeftToeBase ] = { 0.23909662105997093, 0.08062223874282438, 0.01389135527125049 },
-    [animdata_JointKey_LeftToe_End ] = { 0.3318736246139211, 0.0802190399169754, 0.013130254501321088 },
-  }},
-  { .time = 0.2916666567325592, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { -0.041964750289916995, 0.0655658483505249, 1.0297295379638671 },
-    [animdata_JointKey_RightArm    ] = { -0.19360486686130593, 0.02259390501391878, 1.3905363140005023 },
-    [animdata_JointKey_RightForeArm] = { -0.27872281748636285, 0.006940744038107272, 1.1259142882551203 },
-    [animdata_JointKey_RightHand   ] = { -0.3086812683978276, -0.026683847344228805, 0.8462288210224753 },
-    [animdata_JointKey_Neck        ] = { -0.06652755323506407, 0.08455216581728944, 1.491401735001593 },
-    [animdata_JointKey_Head        ] = { -0.04936609880498287, 0.05120248592956581, 1.5815544998223745 },
-    [animdata_JointKey_LeftArm     ] = { 0.07035916655738207, 0.15805470712925146, 1.4120959800941932 },
-    [animdata_JointKey_LeftForeArm ] = { 0.15811879807792292, 0.17610198041809647, 1.1484912588070726 },
-    [animdata_JointKey_LeftHand    ] = { 0.2375804371227939, 0.10536356225861088, 0.8859383855166894 },
-    [animdata_JointKey_RightLeg    ] = { -0.11378388436412057, -0.024534507456173974, 0.5269486256653327 },
-    [animdata_JointKey_RightToeBase] = { -0.13266488181185665, -0.055936789513863036, 0.000009625578518495104 },
-    [animdata_JointKey_RightToe_End] = { -0.17542030581139137, -0.13743590442003456, 0.01176473341934186 },
-    [animdata_JointKey_LeftLeg     ] = { 0.18333897863016205, 0.0652174232957875, 0.5456189930652585 },
-    [animdata_JointKey_LeftToeBase ] = { 0.21151505325935938, 0.13287565421172434, 0.01842737549683946 },
-    [animdata_JointKey_LeftToe_End ] = { 0.3036320279718857, 0.14138302266632305, 0.025526695140209454 },
-  }},
-  { .time = 0.3333333432674408, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { -0.04422932624816894, 0.07559433937072754, 1.0288288879394532 },
-    [animdata_JointKey_RightArm    ] = { -0.19533550221037338, 0.026323149400329867, 1.3877835118393704 },
-    [animdata_JointKey_RightForeArm] = { -0.2864397295752978, 0.003204801470766672, 1.1257139052473741 },
-    [animdata_JointKey_RightHand   ] = { -0.3154477517918189, -0.036542710173568284, 0.846732247078922 },
-    [animdata_JointKey_Neck        ] = { -0.07379349346332457, 0.09677649526725825, 1.4899666389630528 },
-    [animdata_JointKey_Head        ] = { -0.0557945451227136, 0.0653280622177971, 1.580637866911762 },
-    [animdata_JointKey_LeftArm     ] = { 0.05852403678897311, 0.17896221636077417, 1.4107605774273482 },
-    [animdata_JointKey_LeftForeArm ] = { 0.1474638164803734, 0.21424391467797105, 1.1493034345132294 },
-    [animdata_JointKey_LeftHand    ] = { 0.23411078127704776, 0.1456311942831867, 0.8884649881877477 },
-    [animdata_JointKey_RightLeg    ] = { -0.1149188393581282, -0.023937198761303843, 0.5269599605010963 },
-    [animdata_JointKey_RightToeBase] = { -0.1327056104200164, -0.05596717813882023, 0.000009035864072277632 },
-    [animdata_JointKey_RightToe_End] = { -0.17546111382091922, -0.1374662556661071, 0.01176412493510119 },
-    [animdata_JointKey_LeftLeg     ] = { 0.16137104870998065, 0.09626318242010928, 0.5367494519925999 },
-    [animdata_JointKey_LeftToeBase ] = { 0.18869973216473873, 0.17370362073664308, 0.017784620233412252 },
-    [animdata_JointKey_LeftToe_End ] = { 0.27927806916467823, 0.1880594450047479, 0.03184832101119251 },
-  }},
-  { .time = 0.375, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { -0.04167330741882324, 0.08591488838195802, 1.0271098327636718 },
-    [animdata_JointKey_RightArm    ] = { -0.1925360203770912, 0.031593001963278536, 1.3843763783746688 },
-    [animdata_JointKey_RightForeArm] = { -0.28756450021835106, -0.0017325839229207452, 1.1248115194701114 },
-    [animdata_JointKey_RightHand   ] = { -0.31637402118813934, -0.04949770877514039, 0.8470695436264076 },
-    [animdata_JointKey_Neck        ] = { -0.07709590940049312, 0.11045316594144546, 1.4874972186400195 },
-    [animdata_JointKey_Head        ] = { -0.058798895367312955, 0.08123142144545197, 1.5788511816943902 },
-    [animdata_JointKey_LeftArm     ] = { 0.04977374863645857, 0.2012850587562461, 1.407986052075216 },
-    [animdata_JointKey_LeftForeArm ] = { 0.1325290568911696, 0.2520971265750495, 1.1470557769998038 },
-    [animdata_JointKey_LeftHand    ] = { 0.22151614440323983, 0.1912647938332637, 0.8850771154556225 },
-    [animdata_JointKey_RightLeg    ] = { -0.11401712640965181, -0.024710730653661275, 0.526919612702255 },
-    [animdata_JointKey_RightToeBase] = { -0.1326379690950972, -0.05604575333153262, 0.000008696554862037687 },
-    [animdata_JointKey_RightToe_End] = { -0.17539589100445224, -0.1375435544006403, 0.011763816631962794 },
-    [animdata_JointKey_LeftLeg     ] = { 0.13850908664049574, 0.10996934961293009, 0.5272882822671483 },
-    [animdata_JointKey_LeftToeBase ] = { 0.18449089728489518, 0.1931001906810924, 0.011108530416139226 },
-    [animdata_JointKey_LeftToe_End ] = { 0.2733409623447741, 0.21182187600943117, 0.03017366756319649 },
-  }},
-  { .time = 0.4166666567325592, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { -0.03802781581878662, 0.0960343074798584, 1.0237957763671874 },
-    [animdata_JointKey_RightArm    ] = { -0.18907219101445424, 0.03666493234264733, 1.3801979615658857 },
-    [animdata_JointKey_RightForeArm] = { -0.28503190436708914, -0.007727064176499843, 1.1226402024411584 },
-    [animdata_JointKey_RightHand   ] = { -0.31371460318585337, -0.06450870892474084, 0.8465872317801083 },
-    [animdata_JointKey_Neck        ] = { -0.07916657097743107, 0.12281658712959097, 1.4835480841391546 },
-    [animdata_JointKey_Head        ] = { -0.060826387207302456, 0.09564522085387975, 1.5755241254317154 },
-    [animdata_JointKey_LeftArm     ] = { 0.041271533577119775, 0.2218260842923314, 1.4030328577759974 },
-    [animdata_JointKey_LeftForeArm ] = { 0.1116399488375961, 0.28396154494685605, 1.140921453957309 },
-    [animdata_JointKey_LeftHand    ] = { 0.19655503625640855, 0.23329203312245958, 0.8754518253169384 },
-    [animdata_JointKey_RightLeg    ] = { -0.10767879513268375, -0.04061871395210956, 0.5283558126291961 },
-    [animdata_JointKey_RightToeBase] = { -0.13274396539150118, -0.05331393141239998, 0.0014177339971263336 },
-    [animdata_JointKey_RightToe_End] = { -0.1747738862223724, -0.13544022601326622, 0.011270191916986909 },
-    [animdata_JointKey_LeftLeg     ] = { 0.13785070399209468, 0.10806833277265288, 0.524218086853057 },
-    [animdata_JointKey_LeftToeBase ] = { 0.1812869040944571, 0.19597535849119116, 0.0011530970883929649 },
-    [animdata_JointKey_LeftToe_End ] = { 0.27127309042301284, 0.2166804300718162, 0.010214006508951904 },
-  }},
-  { .time = 0.4583333432674408, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { -0.03740286827087402, 0.10342900276184082, 1.020372314453125 },
-    [animdata_JointKey_RightArm    ] = { -0.1891288360123869, 0.03785719651583932, 1.375729249174182 },
-    [animdata_JointKey_RightForeArm] = { -0.28333979590421415, -0.01594909904266655, 1.119323140863848 },
-    [animdata_JointKey_RightHand   ] = { -0.3091136041564446, -0.08017705338966481, 0.8446186172476081 },
-    [animdata_JointKey_Neck        ] = { -0.08456665053752463, 0.12992099138582325, 1.4796574123006465 },
-    [animdata_JointKey_Head        ] = { -0.06645782960418392, 0.10396748726614348, 1.5720301566228834 },
-    [animdata_JointKey_LeftArm     ] = { 0.028866237785817175, 0.2368480885513813, 1.3986785363155503 },
-    [animdata_JointKey_LeftForeArm ] = { 0.08562816022163962, 0.30646750750843366, 1.1351521950188987 },
-    [animdata_JointKey_LeftHand    ] = { 0.1632540720384641, 0.2643658260374862, 0.8659798392453447 },
-    [animdata_JointKey_RightLeg    ] = { -0.0792941525450398, -0.0822340707555807, 0.5385922214122852 },
-    [animdata_JointKey_RightToeBase] = { -0.1346661649258288, -0.03920348905170501, 0.0125427000930849 },
-    [animdata_JointKey_RightToe_End] = { -0.1727875698646328, -0.12378370837584045, 0.013664854980840501 },
-    [animdata_JointKey_LeftLeg     ] = { 0.14277247859928324, 0.11219272940089293, 0.5239075486264372 },
-    [animdata_JointKey_LeftToeBase ] = { 0.18056661824810424, 0.19570582196531103, 0.00012378303741384045 },
-    [animdata_JointKey_LeftToe_End ] = { 0.2706415030597062, 0.2165384554107526, 0.007923099680687577 },
-  }},
-  { .time = 0.5, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { -0.037180547714233396, 0.1080344295501709, 1.019650650024414 },
-    [animdata_JointKey_RightArm    ] = { -0.1867116195340703, 0.03673354512384752, 1.3742872468370617 },
-    [animdata_JointKey_RightForeArm] = { -0.2782415032433305, -0.02569440707091524, 1.118866144268576 },
-    [animdata_JointKey_RightHand   ] = { -0.2993174953490606, -0.09586782124283874, 0.8452174957933302 },
-    [animdata_JointKey_Neck        ] = { -0.08781422173433301, 0.1347123051647915, 1.4785492634373825 },
-    [animdata_JointKey_Head        ] = { -0.06950226923380638, 0.10977481182054605, 1.5711615276303075 },
-    [animdata_JointKey_LeftArm     ] = { 0.017438050950893562, 0.24934171143300418, 1.3968409282717797 },
-    [animdata_JointKey_LeftForeArm ] = { 0.06100867477631727, 0.3218313223637778, 1.1315830030363738 },
-    [animdata_JointKey_LeftHand    ] = { 0.1303143211585443, 0.28560412479651015, 0.8593029862270012 },
-    [animdata_JointKey_RightLeg    ] = { -0.06150401499664132, -0.10953997184049007, 0.549695619743702 },
-    [animdata_JointKey_RightToeBase] = { -0.1308333844557364, -0.025673057116935877, 0.023032128682308743 },
-    [animdata_JointKey_RightToe_End] = { -0.1612646346790512, -0.11256903535696366, 0.011571689003545157 },
-    [animdata_JointKey_LeftLeg     ] = { 0.1435270584636596, 0.11750304547897118, 0.5243942555965595 },
-    [animdata_JointKey_LeftToeBase ] = { 0.1805551820418001, 0.19573355926872926, 0.00012294350321676362 },
-    [animdata_JointKey_LeftToe_End ] = { 0.2706250235863894, 0.21656457619384728, 0.007984667860375964 },
-  }},
-  { .time = 0.5416666865348816, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { -0.037163445949554445, 0.10536535263061524, 1.0219578552246094 },
-    [animdata_JointKey_RightArm    ] = { -0.1809888004532043, 0.02599625625645973, 1.3770131482143746 },
-    [animdata_JointKey_RightForeArm] = { -0.26719767041006137, -0.04392978405245412, 1.1216833561697148 },
-    [animdata_JointKey_RightHand   ] = { -0.2833144964036075, -0.11754298030578969, 0.8486019622716465 },
-    [animdata_JointKey_Neck        ] = { -0.08914094086661786, 0.13128350924196686, 1.4807294718620838 },
-    [animdata_JointKey_Head        ] = { -0.06954567346285156, 0.10787077080509665, 1.5734770153765023 },
-    [animdata_JointKey_LeftArm     ] = { 0.0047480053982610305, 0.2544014580952434, 1.3972559934931008 },
-    [animdata_JointKey_LeftForeArm ] = { 0.0341465084069782, 0.32675173714098804, 1.1300180978168555 },
-    [animdata_JointKey_LeftHand    ] = { 0.09526463219962165, 0.29706302388877304, 0.8549994462185575 },
-    [animdata_JointKey_RightLeg    ] = { -0.0385212100550466, -0.12170485128678898, 0.5566681337244372 },
-    [animdata_JointKey_RightToeBase] = { -0.11246262340342682, -0.029851452014155157, 0.022774934535547704 },
-    [animdata_JointKey_RightToe_End] = { -0.12820630985203943, -0.11954823115878967, 0.005028418449956515 },
-    [animdata_JointKey_LeftLeg     ] = { 0.13940634378528954, 0.1233508877153121, 0.5257564091082975 },
-    [animdata_JointKey_LeftToeBase ] = { 0.1806331146480074, 0.19562351483251378, 0.00012372435058763287 },
-    [animdata_JointKey_LeftToe_End ] = { 0.27070563475680126, 0.21645571545801726, 0.007951514230698661 },
-  }},
-  { .time = 0.5833333134651184, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { -0.036150867938995364, 0.09604328155517579, 1.0245206451416016 },
-    [animdata_JointKey_RightArm    ] = { -0.1703745015686917, 0.005932071623094064, 1.3813006328437722 },
-    [animdata_JointKey_RightForeArm] = { -0.24573977003022698, -0.06878095752874136, 1.1239041486600685 },
-    [animdata_JointKey_RightHand   ] = { -0.2553076246480629, -0.1416011571286443, 0.8503026789061737 },
-    [animdata_JointKey_Neck        ] = { -0.08732083184439215, 0.11965396790491684, 1.4835847924809193 },
-    [animdata_JointKey_Head        ] = { -0.06542854940629432, 0.09825890508568014, 1.5763059706385647 },
-    [animdata_JointKey_LeftArm     ] = { -0.008891287794876091, 0.2516592092421174, 1.3974556553699984 },
-    [animdata_JointKey_LeftForeArm ] = { 0.005178646754776178, 0.3219456568286933, 1.1284263749019272 },
-    [animdata_JointKey_LeftHand    ] = { 0.057594042032980894, 0.3006712185483599, 0.8508437635863539 },
-    [animdata_JointKey_RightLeg    ] = { -0.007237996280615206, -0.11848014795174311, 0.5567662517518778 },
-    [animdata_JointKey_RightToeBase] = { -0.08288386958205786, -0.05979008989299512, 0.015659288396558838 },
-    [animdata_JointKey_RightToe_End] = { -0.07697792297919027, -0.1510514516114126, 0.000013258659833643716 },
-    [animdata_JointKey_LeftLeg     ] = { 0.13472963290327988, 0.12845479428213166, 0.526973755338014 },
-    [animdata_JointKey_LeftToeBase ] = { 0.18065826596643883, 0.1956314144814852, 0.00012202775348018946 },
-    [animdata_JointKey_LeftToe_End ] = { 0.2707334893514743, 0.2164645609251619, 0.00791610566254488 },
-  }},
-  { .time = 0.625, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { -0.03323499441146851, 0.08427834510803223, 1.02743408203125 },
-    [animdata_JointKey_RightArm    ] = { -0.15252839690869624, -0.017106453444106363, 1.3867943979771402 },
-    [animdata_JointKey_RightForeArm] = { -0.21338907481665623, -0.09243828829968952, 1.1257656498986892 },
-    [animdata_JointKey_RightHand   ] = { -0.21458017896582354, -0.15933708131630217, 0.8504926472806866 },
-    [animdata_JointKey_Neck        ] = { -0.0792333577732403, 0.10468973840162484, 1.4872898416158415 },
-    [animdata_JointKey_Head        ] = { -0.05431963040800539, 0.08526804140226583, 1.579682165200015 },
-    [animdata_JointKey_LeftArm     ] = { -0.018605488258350164, 0.2443496951152457, 1.3987131156762982 },
-    [animdata_JointKey_LeftForeArm ] = { -0.019169596107158206, 0.3111881516701771, 1.1284406288236235 },
-    [animdata_JointKey_LeftHand    ] = { 0.02260880592985603, 0.2990788132264853, 0.8485120269012658 },
-    [animdata_JointKey_RightLeg    ] = { 0.024225414719732507, -0.10162814565059364, 0.5541236521226449 },
-    [animdata_JointKey_RightToeBase] = { -0.04689433504086342, -0.10682432634269613, 0.010518877918302607 },
-    [animdata_JointKey_RightToe_End] = { -0.02279749141194357, -0.19584289967503643, 0.00035281210497223325 },
-    [animdata_JointKey_LeftLeg     ] = { 0.12920525415960857, 0.13286249081839327, 0.5281892679695287 },
-    [animdata_JointKey_LeftToeBase ] = { 0.18061552362824818, 0.19558677295911328, 0.000224990167191077 },
-    [animdata_JointKey_LeftToe_End ] = { 0.2706914060529277, 0.2164199974772074, 0.008011236215654064 },
-  }},
-  { .time = 0.6666666865348816, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { -0.026712734699249268, 0.06999528884887696, 1.029628448486328 },
-    [animdata_JointKey_RightArm    ] = { -0.12962159295975886, -0.04050641145016939, 1.3919231284202669 },
-    [animdata_JointKey_RightForeArm] = { -0.17342788681540422, -0.11412108423908857, 1.1270140852038657 },
-    [animdata_JointKey_RightHand   ] = { -0.16416184677498877, -0.17304745946512512, 0.8500774235459454 },
-    [animdata_JointKey_Neck        ] = { -0.06781740483867037, 0.08931030552136822, 1.490137979301142 },
-    [animdata_JointKey_Head        ] = { -0.04042989457261971, 0.07271577098652171, 1.582381046101902 },
-    [animdata_JointKey_LeftArm     ] = { -0.02360199989310851, 0.23392529122193564, 1.4001987935226081 },
-    [animdata_JointKey_LeftForeArm ] = { -0.03275100626078345, 0.2941232308499612, 1.1285235853673228 },
-    [animdata_JointKey_LeftHand    ] = { 0.0007270601233933639, 0.289389822264459, 0.8472605273446829 },
-    [animdata_JointKey_RightLeg    ] = { 0.04112308881320207, -0.08331603316753343, 0.5478407221149945 },
-    [animdata_JointKey_RightToeBase] = { 0.0060754378645858954, -0.14366986540858767, 0.010911399762304512 },
-    [animdata_JointKey_RightToe_End] = { 0.0564283267254205, -0.22159802835502565, 0.010591423323421856 },
-    [animdata_JointKey_LeftLeg     ] = { 0.1253379973113004, 0.137852539692968, 0.5292091160640626 },
-    [animdata_JointKey_LeftToeBase ] = { 0.1806639385144037, 0.1956968719685359, 0.0003997397178114248 },
-    [animdata_JointKey_LeftToe_End ] = { 0.27073955688225104, 0.2165300269139187, 0.008189277715536748 },
-  }},
-  { .time = 0.7083333134651184, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { -0.013955214023590089, 0.050803484916687014, 1.0286903381347656 },
-    [animdata_JointKey_RightArm    ] = { -0.102796778706755, -0.06541537478017719, 1.3940526475997002 },
-    [animdata_JointKey_RightForeArm] = { -0.12776830217139373, -0.13624967916506478, 1.1259596844086301 },
-    [animdata_JointKey_RightHand   ] = { -0.1070635059395074, -0.18771978313064927, 0.848157182596141 },
-    [animdata_JointKey_Neck        ] = { -0.05507605918391228, 0.07234443782707016, 1.4892871681976112 },
-    [animdata_JointKey_Head        ] = { -0.02666791712423918, 0.0599004844242085, 1.5818742261653647 },
-    [animdata_JointKey_LeftArm     ] = { -0.02399438311001472, 0.21949927770218286, 1.3992068946259195 },
-    [animdata_JointKey_LeftForeArm ] = { -0.03429459871622061, 0.27084682517032926, 1.1257617536531286 },
-    [animdata_JointKey_LeftHand    ] = { -0.005991117792658254, 0.2740875352149102, 0.8439098437721921 },
-    [animdata_JointKey_RightLeg    ] = { 0.026261667011202867, -0.0775469317623307, 0.5336254122367544 },
-    [animdata_JointKey_RightToeBase] = { 0.046065681960848204, -0.14014847379380269, 0.003060397858281281 },
-    [animdata_JointKey_RightToe_End] = { 0.12172509759704901, -0.1930631422998694, 0.012225854935038765 },
-    [animdata_JointKey_LeftLeg     ] = { 0.13009014833912508, 0.1418035831727639, 0.5289544083643427 },
-    [animdata_JointKey_LeftToeBase ] = { 0.18058450951126234, 0.19544175581607953, 0.00040381510139051005 },
-    [animdata_JointKey_LeftToe_End ] = { 0.27066041291731824, 0.2162743398681682, 0.008191648023866212 },
-  }},
-  { .time = 0.75, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { -0.0019271719455718995, 0.03306144714355469, 1.0273825073242189 },
-    [animdata_JointKey_RightArm    ] = { -0.08156319009203063, -0.08678305936591964, 1.3945959655968598 },
-    [animdata_JointKey_RightForeArm] = { -0.09218147162755576, -0.1504079710752506, 1.1237564534063453 },
-    [animdata_JointKey_RightHand   ] = { -0.064501416851653, -0.1933328817275057, 0.845110866790221 },
-    [animdata_JointKey_Neck        ] = { -0.04445284496938632, 0.0554523980750918, 1.4879254820900483 },
-    [animdata_JointKey_Head        ] = { -0.01586082727468973, 0.04580451995573029, 1.5807891063028552 },
-    [animdata_JointKey_LeftArm     ] = { -0.01976739356233008, 0.2038157440286134, 1.3993364858177026 },
-    [animdata_JointKey_LeftForeArm ] = { -0.02711101494780518, 0.24869893832350992, 1.1246612754078986 },
-    [animdata_JointKey_LeftHand    ] = { -0.004250142722876325, 0.26060347785561855, 0.8425482768646104 },
-    [animdata_JointKey_RightLeg    ] = { 0.02634333375480735, -0.08291179832899868, 0.5276786372109451 },
-    [animdata_JointKey_RightToeBase] = { 0.05535643582646284, -0.1338637901705217, 0.000008900365369317598 },
-    [animdata_JointKey_RightToe_End] = { 0.1368553646335414, -0.17661957516047866, 0.011763989562004556 },
-    [animdata_JointKey_LeftLeg     ] = { 0.13414885027768614, 0.14222247250134076, 0.5284598103362496 },
-    [animdata_JointKey_LeftToeBase ] = { 0.18060900653636666, 0.19543474128938162, 0.00039028789551837306 },
-    [animdata_JointKey_LeftToe_End ] = { 0.2706848194990627, 0.21626775830879524, 0.008177983573048423 },
-  }},
-  { .time = 0.7916666865348816, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.006902788281440735, 0.01905509352684021, 1.027333755493164 },
-    [animdata_JointKey_RightArm    ] = { -0.06384112563029014, -0.10734366276937021, 1.3942435089732264 },
-    [animdata_JointKey_RightForeArm] = { -0.06478561728088007, -0.16151665685852898, 1.1211513700939721 },
-    [animdata_JointKey_RightHand   ] = { -0.03380352461301898, -0.19465939804260587, 0.8415198833683522 },
-    [animdata_JointKey_Neck        ] = { -0.036842558729542264, 0.036831489132524646, 1.4879493091153284 },
-    [animdata_JointKey_Head        ] = { -0.00787754055739808, 0.028553161419287078, 1.5808295255366225 },
-    [animdata_JointKey_LeftArm     ] = { -0.017067039980036582, 0.18699541671257863, 1.4023644178152939 },
-    [animdata_JointKey_LeftForeArm ] = { -0.020939428789557783, 0.22870775555888723, 1.1271190802362123 },
-    [animdata_JointKey_LeftHand    ] = { -0.0026903332946354563, 0.24877045978697004, 0.8451322935554343 },
-    [animdata_JointKey_RightLeg    ] = { 0.03610077230558672, -0.08791168817771264, 0.526149438703089 },
-    [animdata_JointKey_RightToeBase] = { 0.05570006585904455, -0.1333617939654565, 0.000009765891871911236 },
-    [animdata_JointKey_RightToe_End] = { 0.1371988482292623, -0.17611784306447287, 0.011764864889019138 },
-    [animdata_JointKey_LeftLeg     ] = { 0.13304452372907422, 0.14168172260335743, 0.5285849902992009 },
-    [animdata_JointKey_LeftToeBase ] = { 0.18061522371651478, 0.19543364268806226, 0.0004061819412199874 },
-    [animdata_JointKey_LeftToe_End ] = { 0.2706920822788315, 0.21626257479019312, 0.008192635884592705 },
-  }},
-  { .time = 0.8333333134651184, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.012090926170349122, 0.009863368272781373, 1.02688232421875 },
-    [animdata_JointKey_RightArm    ] = { -0.0509884081320235, -0.12454837343999346, 1.392213207170431 },
-    [animdata_JointKey_RightForeArm] = { -0.04627316039378156, -0.17111535013867307, 1.117760667875503 },
-    [animdata_JointKey_RightHand   ] = { -0.013869002935988957, -0.19636540491850318, 0.8374670780659459 },
-    [animdata_JointKey_Neck        ] = { -0.03308324232518548, 0.019883940886164086, 1.4875209124966877 },
-    [animdata_JointKey_Head        ] = { -0.003914881124459351, 0.012081092812188658, 1.5803786527692785 },
-    [animdata_JointKey_LeftArm     ] = { -0.016546885568943966, 0.17193690772892595, 1.405766009122407 },
-    [animdata_JointKey_LeftForeArm ] = { -0.01434628325206406, 0.21259191451721524, 1.1303440978727255 },
-    [animdata_JointKey_LeftHand    ] = { 0.002342552741028783, 0.24033356586740656, 0.8489121094443857 },
-    [animdata_JointKey_RightLeg    ] = { 0.04325682681332044, -0.09063835717351211, 0.5248463873856287 },
-    [animdata_JointKey_RightToeBase] = { 0.05584859064665754, -0.1328804462211301, 0.00000928544722965441 },
-    [animdata_JointKey_RightToe_End] = { 0.13734745921193997, -0.17563634130222458, 0.011764390465966824 },
-    [animdata_JointKey_LeftLeg     ] = { 0.1314015890566761, 0.14239476496201672, 0.528817151272588 },
-    [animdata_JointKey_LeftToeBase ] = { 0.18055531103985661, 0.19551463693685484, 0.0003958889969250734 },
-    [animdata_JointKey_LeftToe_End ] = { 0.270631527203338, 0.21634635828239077, 0.008182358708531724 },
-  }},
-  { .time = 0.875, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.014447883367538453, 0.004322699308395386, 1.0265229034423828 },
-    [animdata_JointKey_RightArm    ] = { -0.04468148747853158, -0.13529598779844215, 1.3906833237199774 },
-    [animdata_JointKey_RightForeArm] = { -0.0373365082293284, -0.1788284548904224, 1.1157908306881812 },
-    [animdata_JointKey_RightHand   ] = { -0.004389844589399248, -0.20093238753262518, 0.8352948073739324 },
-    [animdata_JointKey_Neck        ] = { -0.03220413298769908, 0.008928963053737353, 1.4870333907310502 },
-    [animdata_JointKey_Head        ] = { -0.003176893139216852, 0.0012702617725841147, 1.57994733657021 },
-    [animdata_JointKey_LeftArm     ] = { -0.01613992046062319, 0.161963641643382, 1.408088776568912 },
-    [animdata_JointKey_LeftForeArm ] = { -0.006993072356485886, 0.20184147639203545, 1.1326963338084077 },
-    [animdata_JointKey_LeftHand    ] = { 0.010343405002489972, 0.2350624392052785, 0.8518976573239132 },
-    [animdata_JointKey_RightLeg    ] = { 0.04654728696075661, -0.09255757966999421, 0.5241939449121822 },
-    [animdata_JointKey_RightToeBase] = { 0.0559463222720092, -0.13275038322857713, 0.000009320761844175962 },
-    [animdata_JointKey_RightToe_End] = { 0.1374461967307123, -0.17550435615107332, 0.011764420314500956 },
-    [animdata_JointKey_LeftLeg     ] = { 0.13057591986973396, 0.14304129481866587, 0.5289599766018273 },
-    [animdata_JointKey_LeftToeBase ] = { 0.18057560313601337, 0.19548127398334758, 0.0003901822809297073 },
-    [animdata_JointKey_LeftToe_End ] = { 0.27065151267689064, 0.2163142554107389, 0.008176810529927574 },
-  }},
+/* cooked by anim_cooker from joints/turn90_left.txt: 22 of 22 keys kept at 0.001m tolerance */
+
+float animdata_turn90_left_key_times[] = {
+  0, 0.0416666679, 0.0833333358, 0.125, 0.166666672, 0.208333328, 0.25, 0.291666657,
+  0.333333343, 0.375, 0.416666657, 0.458333343, 0.5, 0.541666687, 0.583333313, 0.625,
+  0.666666687, 0.708333313, 0.75, 0.791666687, 0.833333313, 0.875,
+};
+
+uint16_t animdata_turn90_left_keys[] = {
+  /* joint  0 x */ 31227, 31061, 30603, 29895, 29013, 28172, 27403, 26827, 26605, 26855, 27212, 27273, 27294, 27296, 27395, 27680, 28318, 29565, 30741, 31604, 32111, 32342,
+  /* joint  0 y */ 28057, 29092, 30305, 31700, 33109, 34431, 35694, 36882, 37982, 39114, 40224, 41035, 41541, 41248, 40225, 38934, 37368, 35262, 33316, 31779, 30771, 30163,
+  /* joint  0 z */ 42508, 42462, 42467, 42536, 42642, 42650, 42653, 42647, 42609, 42538, 42401, 42259, 42229, 42325, 42431, 42552, 42642, 42604, 42549, 42547, 42529, 42514,
+  /* joint  1 x */ 17310, 16381, 15398, 14536, 13674, 13077, 12476, 12002, 11833, 12107, 12445, 12440, 12676, 13235, 14273, 16018, 18257, 20880, 22955, 24688, 25945, 26561,
+  /* joint  1 y */ 34352, 33082, 32073, 31490, 31258, 31416, 31780, 32167, 32576, 33155, 33711, 33842, 33719, 32541, 30339, 27812, 25245, 22512, 20168, 17913, 16025, 14846,
+  /* joint  1 z */ 57561, 57519, 57505, 57567, 57657, 57666, 57644, 57590, 57476, 57335, 57161, 56976, 56917, 57030, 57207, 57435, 57647, 57735, 57758, 57743, 57659, 57596,
+  /* joint  2 x */ 13142, 12041, 10655,  9129,  7550,  6151,  4834,  3681,  2926,  2816,  3064,  3229,  3728,  4808,  6905, 10068, 13975, 18438, 21917, 24596, 26405, 27279,
+  /* joint  2 y */ 33410, 32574, 31932, 31578, 31278, 30974, 30723, 30450, 30040, 29499, 28841, 27939, 26870, 24869, 22143, 19548, 17169, 14741, 13188, 11969, 10916, 10070,
+  /* joint  2 z */ 46172, 46138, 46151, 46266, 46422, 46516, 46585, 46630, 46622, 46584, 46495, 46357, 46338, 46455, 46547, 46624, 46676, 46632, 46541, 46433, 46292, 46211,
+  /* joint  3 x */ 11069, 10173,  8820,  7081,  5226,  3441,  1910,   752,    91,     0,   260,   710,  1667,  3232,  5970,  9952, 14880, 20463, 24623, 27625, 29573, 30500,
+  /* joint  3 y */ 29761, 29485, 29300, 29264, 29032, 28414, 27634, 26761, 25680, 24259, 22612, 20893, 19171, 16794, 14154, 12209, 10705,  9095,  8479,  8334,  8146,  7645,
+  /* joint  3 z */ 34553, 34490, 34486, 34599, 34761, 34880, 34976, 35047, 35068, 35082, 35062, 34980, 35005, 35145, 35215, 35223, 35206, 35127, 35000, 34852, 34684, 34594,
+  /* joint  4 x */ 31388, 30426, 29304, 28253, 27130, 26255, 25318, 24425, 23715, 23392, 23190, 22662, 22344, 22215, 22393, 23183, 24299, 25545, 26583, 27327, 27695, 27781,
+  /* joint  4 y */ 33269, 33282, 33586, 34237, 35162, 36387, 37681, 38964, 40306, 41806, 43162, 43942, 44467, 44091, 42815, 41174, 39486, 37625, 35772, 33729, 31870, 30668,
+  /* joint  4 z */ 61575, 61564, 61588, 61667, 61778, 61786, 61784, 61767, 61708, 61605, 61442, 61281, 61235, 61325, 61443, 61597, 61715, 61679, 61623, 61624, 61606, 61586,
+  /* joint  5 x */ 30641, 29984, 29270, 28720, 28060, 27557, 26847, 26103, 25475, 25181, 24983, 24432, 24135, 24130, 24533, 25619, 26977, 28322, 29379, 30159, 30546, 30619,
+  /* joint  5 y */ 30098, 29833, 29874, 30313, 31147, 32428, 33852, 35306, 36856, 38600, 40181, 41094, 41732, 41523, 40468, 39043, 37666, 36260, 34714, 32821, 31014, 29828,
+  /* joint  5 z */ 65425, 65388, 65381, 65425, 65506, 65503, 65505, 65501, 65463, 65389, 65251, 65106, 65070, 65166, 65283, 65423, 65535, 65514, 65469, 65471, 65452, 65434,
+  /* joint  6 x */ 46394, 45560, 44401, 43132, 41681, 40409, 39095, 37808, 36651, 35795, 34964, 33751, 32634, 31393, 30060, 29110, 28622, 28583, 28997, 29261, 29312, 29351,
+  /* joint  6 y */ 31530, 33313, 35392, 37720, 40141, 42564, 44826, 47028, 49322, 51771, 54024, 55672, 57043, 57598, 57297, 56495, 55351, 53769, 52048, 50203, 48551, 47457,
+  /* joint  6 z */ 58364, 58378, 58421, 58490, 58588, 58551, 58515, 58483, 58427, 58312, 58107, 57927, 57851, 57868, 57876, 57928, 57990, 57949, 57954, 58079, 58220, 58317,
+  /* joint  7 x */ 50280, 49781, 49148, 48578, 48034, 47607, 47091, 46387, 45346, 43885, 41843, 39300, 36894, 34267, 31435, 29055, 27727, 27577, 28279, 28882, 29527, 30246,
+  /* joint  7 y */ 30169, 31921, 33586, 35564, 38196, 41456, 45073, 49008, 53192, 57345, 60841, 63310, 64995, 65535, 65008, 63828, 61955, 59402, 56972, 54779, 53011, 51832,
+  /* joint  7 z */ 46963, 46999, 47088, 47222, 47400, 47438, 47493, 47565, 47599, 47506, 47252, 47013, 46865, 46800, 46734, 46735, 46738, 46624, 46578, 46680, 46814, 46911,
+  /* joint  8 x */ 53764, 53400, 53263, 53309, 53468, 53712, 54009, 54155, 53816, 52585, 50145, 46889, 43669, 40242, 36560, 33139, 31000, 30344, 30514, 30666, 31158, 31940,
+  /* joint  8 y */ 28195, 29474, 30405, 31459, 33011, 35081, 37767, 41248, 45665, 50671, 55282, 58691, 61021, 62278, 62674, 62499, 61436, 59757, 58278, 56980, 56054, 55476,
+  /* joint  8 z */ 35347, 35404, 35548, 35766, 36063, 36250, 36472, 36691, 36796, 36656, 36257, 35865, 35588, 35410, 35238, 35141, 35090, 34951, 34894, 35001, 35158, 35282,
+  /* joint  9 x */ 21848, 21593, 21308, 21036, 20767, 20388, 20050, 19806, 19695, 19783, 20402, 23177, 24916, 27163, 30222, 33298, 34949, 33497, 33505, 34458, 35158, 35480,
+  /* joint  9 y */ 24480, 24134, 24183, 24831, 25866, 26323, 26728, 26997, 27063, 26978, 25233, 20667, 17672, 16337, 16691, 18540, 20548, 21181, 20593, 20044, 19745, 19535,
+  /* joint  9 z */ 21701, 21673, 21673, 21716, 21781, 21801, 21816, 21824, 21824, 21822, 21882, 22306, 22766, 23054, 23058, 22949, 22689, 22100, 21854, 21790, 21737, 21709,
+  /* joint 10 x */ 17961, 17966, 17963, 17968, 17963, 17961, 17960, 17960, 17956, 17962, 17952, 17764, 18139, 19935, 22826, 26345, 31523, 35433, 36341, 36375, 36389, 36399,
+  /* joint 10 y */ 23555, 23547, 23544, 23544, 23553, 23553, 23553, 23552, 23549, 23540, 23840, 25388, 26872, 26414, 23129, 17970, 13927, 14314, 15003, 15058, 15111, 15125,
+  /* joint 10 z */     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,    58,   519,   954,   943,   648,   435,   452,   126,     0,     0,     0,     0,
+  /* joint 11 x */ 13781, 13786, 13783, 13788, 13783, 13781, 13780, 13780, 13776, 13782, 13843, 14037, 15164, 18396, 23404, 28700, 36446, 42829, 44308, 44342, 44357, 44366,
+  /* joint 11 y */ 14614, 14606, 14604, 14603, 14612, 14612, 14612, 14611, 14608, 14599, 14830, 16109, 17339, 16574, 13118,  8204,  5378,  8509, 10313, 10368, 10420, 10435,
+  /* joint 11 z */   487,   487,   487,   487,   487,   487,   487,   487,   487,   487,   466,   566,   479,   208,     0,    14,   438,   506,   487,   487,   487,   487,
+  /* joint 12 x */ 45231, 47033, 48802, 49833, 50815, 51080, 50288, 48853, 46705, 44470, 44406, 44887, 44961, 44558, 44101, 43561, 43182, 43647, 44044, 43936, 43775, 43695,
+  /* joint 12 y */ 15470, 16594, 18225, 21386, 25199, 29096, 32874, 36843, 40249, 41753, 41544, 41997, 42579, 43221, 43781, 44264, 44812, 45245, 45291, 45232, 45310, 45381,
+  /* joint 12 z */ 21919, 22137, 22451, 22656, 22890, 22928, 22821, 22597, 22229, 21838, 21710, 21698, 21718, 21774, 21825, 21875, 21917, 21907, 21886, 21891, 21901, 21907,
+  /* joint 13 x */ 50047, 50255, 50804, 52617, 55577, 56598, 54304, 51607, 49377, 48965, 48652, 48582, 48581, 48588, 48591, 48586, 48591, 48583, 48586, 48586, 48581, 48583,
+  /* joint 13 y */  9882, 10268, 11118, 14698, 22029, 31630, 38533, 44266, 48745, 50873, 51188, 51159, 51162, 51150, 51150, 51146, 51158, 51130, 51129, 51129, 51138, 51134,
+  /* joint 13 z */    15,   133,   393,   456,   461,   436,   575,   763,   736,   460,    47,     5,     5,     5,     5,     9,    16,    16,    16,    16,    16,    16,
+  /* joint 14 x */ 52083, 52609, 54013, 57700, 63150, 65535, 63374, 60613, 58232, 57651, 57449, 57388, 57386, 57394, 57397, 57392, 57397, 57389, 57392, 57392, 57387, 57389,
+  /* joint 14 y */     0,   458,  1604,  6268, 16443, 29988, 38489, 45199, 50320, 52927, 53460, 53444, 53447, 53435, 53436, 53431, 53443, 53415, 53414, 53414, 53423, 53419,
+  /* joint 14 z */   338,   370,   523,   454,   296,   221,   543,  1057,  1319,  1249,   423,   328,   330,   329,   327,   331,   339,   339,   338,   339,   339,   338,
+};
+
+animdata_Clip animdata_turn90_left_clip = {
+  .duration  = 0.916666687,
+  .key_count = 22,
+  .key_times = animdata_turn90_left_key_times,
+  .min       = { -0.316374034, -0.27062273, 8.652014e-06 },
+  .extent    = { 0.670355678, 0.597374439, 1.58237231 },
+  .keys      = animdata_turn90_left_keys,
 };
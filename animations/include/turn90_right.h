@@ -1,377 +1,64 @@
-float animdata_turn90_right_duration = 0.9166666865348816;
-animdata_Frame animdata_turn90_right_frames[] = {
-  { .time = 0, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.004311855733394623, -0.013636194467544556, 1.0337986755371094 },
-    [animdata_JointKey_RightArm    ] = { -0.14712375762397215, 0.011515638168588726, 1.3987209833466994 },
-    [animdata_JointKey_RightForeArm] = { -0.18926262064828575, -0.006613206145519923, 1.1241111189490243 },
-    [animdata_JointKey_RightHand   ] = { -0.20514931926100322, -0.04415939362826791, 0.8437720529692301 },
-    [animdata_JointKey_Neck        ] = { -0.003587268040932815, 0.03340140546512097, 1.494367620095483 },
-    [animdata_JointKey_Head        ] = { -0.003944577083283109, 0.0036836662786556796, 1.5873781892095684 },
-    [animdata_JointKey_LeftArm     ] = { 0.14899719685551308, 0.05123745954443615, 1.415460175403199 },
-    [animdata_JointKey_LeftForeArm ] = { 0.18809633200630133, 0.04730126969667965, 1.1398323898237008 },
-    [animdata_JointKey_LeftHand    ] = { 0.2243498683814776, 0.03701127952614354, 0.8590622205134096 },
-    [animdata_JointKey_RightLeg    ] = { -0.07919887620007192, -0.043954131583772885, 0.5278661210559319 },
-    [animdata_JointKey_RightToeBase] = { -0.11717454504549712, -0.0836306852285926, 0.00001025060738051309 },
-    [animdata_JointKey_RightToe_End] = { -0.14101918425966803, -0.17251921514436971, 0.011782095985922253 },
-    [animdata_JointKey_LeftLeg     ] = { 0.1427072089160915, -0.08045646358895116, 0.5299659377139162 },
-    [animdata_JointKey_LeftToeBase ] = { 0.23058407598428077, -0.13310873986467608, 0.0012757549751194475 },
-    [animdata_JointKey_LeftToe_End ] = { 0.2706244234355546, -0.21644212608065594, 0.009062332312424447 },
-  }},
-  { .time = 0.0416666679084301, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.013091627359390259, -0.007883768081665039, 1.0297657775878906 },
-    [animdata_JointKey_RightArm    ] = { -0.1351415875324134, 0.02355137313999129, 1.3954364195013527 },
-    [animdata_JointKey_RightForeArm] = { -0.18021883215746934, 0.005517272237493378, 1.121287350221295 },
-    [animdata_JointKey_RightHand   ] = { -0.19709671698284872, -0.03881037935469227, 0.8419984758874185 },
-    [animdata_JointKey_Neck        ] = { 0.009834740260233697, 0.03589786661654771, 1.4907578732848483 },
-    [animdata_JointKey_Head        ] = { 0.007098299660154107, 0.005342117252962915, 1.5834568254403159 },
-    [animdata_JointKey_LeftArm     ] = { 0.1629097516919417, 0.045164907573849666, 1.411653271245549 },
-    [animdata_JointKey_LeftForeArm ] = { 0.2051126826927006, 0.044292828475483735, 1.1364568715635077 },
-    [animdata_JointKey_LeftHand    ] = { 0.24302794839608616, 0.03569842268832301, 0.8558492207517975 },
-    [animdata_JointKey_RightLeg    ] = { -0.0814334516129355, -0.055519599754519644, 0.5260645671971484 },
-    [animdata_JointKey_RightToeBase] = { -0.11931413478263023, -0.08364639837541223, 0.000009715535809498022 },
-    [animdata_JointKey_RightToe_End] = { -0.14345085224550722, -0.17243862933692974, 0.011912320695778118 },
-    [animdata_JointKey_LeftLeg     ] = { 0.14921607432645928, -0.09278306350190393, 0.5287772411074059 },
-    [animdata_JointKey_LeftToeBase ] = { 0.23035969558262004, -0.133266099536414, 0.0008819780649882247 },
-    [animdata_JointKey_LeftToe_End ] = { 0.27040194080281693, -0.21659839389272453, 0.00867052445973351 },
-  }},
-  { .time = 0.0833333358168602, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.033922362327575686, 0.0018232238292694091, 1.0235768890380859 },
-    [animdata_JointKey_RightArm    ] = { -0.11055318556606418, 0.03793860549654248, 1.3906522417869613 },
-    [animdata_JointKey_RightForeArm] = { -0.16116762448617078, 0.023067940846667804, 1.1172807765968522 },
-    [animdata_JointKey_RightHand   ] = { -0.1837721180323117, -0.027753915331760456, 0.8395070019418495 },
-    [animdata_JointKey_Neck        ] = { 0.035603911334701414, 0.04128084701133673, 1.4850380699460362 },
-    [animdata_JointKey_Head        ] = { 0.03020762574871648, 0.0092145221742752, 1.577107981326355 },
-    [animdata_JointKey_LeftArm     ] = { 0.18836044913796138, 0.04306890561152826, 1.4050866872310186 },
-    [animdata_JointKey_LeftForeArm ] = { 0.2345607953090685, 0.04624888428595165, 1.1305501171582657 },
-    [animdata_JointKey_LeftHand    ] = { 0.27435256139635966, 0.03955381318835716, 0.8501506123768978 },
-    [animdata_JointKey_RightLeg    ] = { -0.08292525683968327, -0.07897532540163309, 0.527126166159586 },
-    [animdata_JointKey_RightToeBase] = { -0.1331648277103506, -0.07012654199695821, 0.002348191350231179 },
-    [animdata_JointKey_RightToe_End] = { -0.16454669639462732, -0.15712768776639321, 0.009716586545974602 },
-    [animdata_JointKey_LeftLeg     ] = { 0.15861844995358532, -0.10770227714271059, 0.5268921213663176 },
-    [animdata_JointKey_LeftToeBase ] = { 0.23027300865264472, -0.13328846927484997, 0.0004936408760673317 },
-    [animdata_JointKey_LeftToe_End ] = { 0.2703138489232022, -0.21662155142979708, 0.008280959223730323 },
-  }},
-  { .time = 0.125, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.059533905982971196, 0.009743117094039917, 1.0220771026611328 },
-    [animdata_JointKey_RightArm    ] = { -0.08334060273961603, 0.05063800053823842, 1.3895835188066736 },
-    [animdata_JointKey_RightForeArm] = { -0.13850419424005053, 0.044113450314923, 1.1167661355594563 },
-    [animdata_JointKey_RightHand   ] = { -0.1681659985683672, -0.011634894933721478, 0.840606047511685 },
-    [animdata_JointKey_Neck        ] = { 0.06276529718572771, 0.04450026859734484, 1.4839138918830999 },
-    [animdata_JointKey_Head        ] = { 0.0535516476590443, 0.010710277490046369, 1.575059834361242 },
-    [animdata_JointKey_LeftArm     ] = { 0.21546823580629842, 0.03888270687853843, 1.4041927178311928 },
-    [animdata_JointKey_LeftForeArm ] = { 0.2691082817974706, 0.045898505979511624, 1.1310838906501741 },
-    [animdata_JointKey_LeftHand    ] = { 0.31382430929727795, 0.040661089549904085, 0.8513963288564523 },
-    [animdata_JointKey_RightLeg    ] = { -0.07903010142439977, -0.07436812338362556, 0.5296290750803256 },
-    [animdata_JointKey_RightToeBase] = { -0.14450416896673265, -0.039603370659939345, 0.0038267006713609674 },
-    [animdata_JointKey_RightToe_End] = { -0.1896868998600992, -0.12057405057027555, 0.007079924479530327 },
-    [animdata_JointKey_LeftLeg     ] = { 0.16466700719332436, -0.11218162223493466, 0.5264577439348929 },
-    [animdata_JointKey_LeftToeBase ] = { 0.23007603244160138, -0.13338578143976254, 0.0004752307045276183 },
-    [animdata_JointKey_LeftToe_End ] = { 0.2701163567900665, -0.21671900988722612, 0.00826365702242266 },
-  }},
-  { .time = 0.1666666716337204, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.08125505447387696, 0.01691547989845276, 1.0229303741455078 },
-    [animdata_JointKey_RightArm    ] = { -0.06069162549984497, 0.0643707532123358, 1.3904940015114904 },
-    [animdata_JointKey_RightForeArm] = { -0.11881459709671255, 0.07154000132866851, 1.1183079795604562 },
-    [animdata_JointKey_RightHand   ] = { -0.15670884452475034, 0.012754567179580328, 0.843789515449935 },
-    [animdata_JointKey_Neck        ] = { 0.0844853276720914, 0.048454696043650824, 1.4849702270647425 },
-    [animdata_JointKey_Head        ] = { 0.07118871688699781, 0.013789921068182389, 1.5752796461472605 },
-    [animdata_JointKey_LeftArm     ] = { 0.23695712039692116, 0.03447682220264084, 1.4058491577331271 },
-    [animdata_JointKey_LeftForeArm ] = { 0.29940326932682376, 0.04279102466774529, 1.134655014952955 },
-    [animdata_JointKey_LeftHand    ] = { 0.3501770925411866, 0.036782509580811265, 0.8560190411086567 },
-    [animdata_JointKey_RightLeg    ] = { -0.07706936502580113, -0.056382492501029065, 0.5323049613708791 },
-    [animdata_JointKey_RightToeBase] = { -0.14004430513952454, -0.007240397778183621, 0.005463971049949787 },
-    [animdata_JointKey_RightToe_End] = { -0.1994235543258279, -0.07846542237608752, 0.00853228862758224 },
-    [animdata_JointKey_LeftLeg     ] = { 0.1691812896931662, -0.1102868580479601, 0.5271121402843629 },
-    [animdata_JointKey_LeftToeBase ] = { 0.23002450663793972, -0.13330948823692057, 0.0006472028491862326 },
-    [animdata_JointKey_LeftToe_End ] = { 0.2700648664996248, -0.2166428323389436, 0.008434182799000182 },
-  }},
-  { .time = 0.2083333283662796, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.09619115829467774, 0.021935887336730957, 1.0217117309570312 },
-    [animdata_JointKey_RightArm    ] = { -0.041901244571777234, 0.07841181005054082, 1.3905744564872657 },
-    [animdata_JointKey_RightForeArm] = { -0.10254236190322996, 0.10344083746647281, 1.1199989164092008 },
-    [animdata_JointKey_RightHand   ] = { -0.152793424275189, 0.0438676627436309, 0.8476425953279219 },
-    [animdata_JointKey_Neck        ] = { 0.10258361422318803, 0.052820781890405434, 1.4837912874260173 },
-    [animdata_JointKey_Head        ] = { 0.08658248865594166, 0.018665361138786904, 1.5738557580801598 },
-    [animdata_JointKey_LeftArm     ] = { 0.2533783142513759, 0.029037447789137753, 1.4037283696465261 },
-    [animdata_JointKey_LeftForeArm ] = { 0.32130522455364896, 0.034617537938231906, 1.1337844881565107 },
-    [animdata_JointKey_LeftHand    ] = { 0.37441060042921487, 0.02415358847824709, 0.8557154227018023 },
-    [animdata_JointKey_RightLeg    ] = { -0.07237706657181747, -0.03359172527777906, 0.5306970506281106 },
-    [animdata_JointKey_RightToeBase] = { -0.09883736994133369, 0.02866911095707925, 0.005151693343070747 },
-    [animdata_JointKey_RightToe_End] = { -0.17163716026997372, -0.028687471460712752, 0.009479150066043074 },
-    [animdata_JointKey_LeftLeg     ] = { 0.17036179418305192, -0.11231608886910613, 0.5268458523246788 },
-    [animdata_JointKey_LeftToeBase ] = { 0.2299852118379403, -0.1332859723927546, 0.0006899687496922979 },
-    [animdata_JointKey_LeftToe_End ] = { 0.2700258921129431, -0.2166191909255582, 0.00847667636456518 },
-  }},
-  { .time = 0.25, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.10681119918823243, 0.02588992118835449, 1.0191424560546876 },
-    [animdata_JointKey_RightArm    ] = { -0.02534849534531858, 0.09246681929201202, 1.3898075224446211 },
-    [animdata_JointKey_RightForeArm] = { -0.08565685046579506, 0.13626054630603104, 1.1215540458567592 },
-    [animdata_JointKey_RightHand   ] = { -0.15128230158510328, 0.0785319221188455, 0.852086420727469 },
-    [animdata_JointKey_Neck        ] = { 0.11843828781422554, 0.05803305264881489, 1.4810865911869238 },
-    [animdata_JointKey_Head        ] = { 0.10103761199407961, 0.025445908828971093, 1.5714720556920858 },
-    [animdata_JointKey_LeftArm     ] = { 0.2664030647705943, 0.024304805973480236, 1.399220863819428 },
-    [animdata_JointKey_LeftForeArm ] = { 0.33671896020180664, 0.024580928173525435, 1.1298317073608055 },
-    [animdata_JointKey_LeftHand    ] = { 0.38794477329124355, 0.00653298499228671, 0.851798822032561 },
-    [animdata_JointKey_RightLeg    ] = { -0.062283347387378944, -0.018679071888926656, 0.5274825642648923 },
-    [animdata_JointKey_RightToeBase] = { -0.06627024853373659, 0.06951860998855404, 0.0062214860682103 },
-    [animdata_JointKey_RightToe_End] = { -0.14977627377755562, 0.029305298903369793, 0.010458036747164024 },
-    [animdata_JointKey_LeftLeg     ] = { 0.16901218139324037, -0.11685911280650416, 0.5259939098721927 },
-    [animdata_JointKey_LeftToeBase ] = { 0.2299833680555903, -0.13326659616798356, 0.000688274964206439 },
-    [animdata_JointKey_LeftToe_End ] = { 0.2700239502704721, -0.21659987906859876, 0.008474786076319739 },
-  }},
-  { .time = 0.2916666567325592, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.113387451171875, 0.030153770446777344, 1.0168348693847657 },
-    [animdata_JointKey_RightArm    ] = { -0.011790122455646817, 0.1073211482536643, 1.389009529008777 },
-    [animdata_JointKey_RightForeArm] = { -0.06720699477954473, 0.16797619132034114, 1.1229928944773249 },
-    [animdata_JointKey_RightHand   ] = { -0.14860119557286053, 0.11592079216896534, 0.8566898488658197 },
-    [animdata_JointKey_Neck        ] = { 0.13066071590251907, 0.06410284043952269, 1.4785049679256022 },
-    [animdata_JointKey_Head        ] = { 0.11219830497451834, 0.03355459616087788, 1.5693905102689554 },
-    [animdata_JointKey_LeftArm     ] = { 0.27511675747332737, 0.020481049762186055, 1.3949154921215279 },
-    [animdata_JointKey_LeftForeArm ] = { 0.34713041041666404, 0.015245808224580564, 1.1260260363519814 },
-    [animdata_JointKey_LeftHand    ] = { 0.39406569785932327, -0.011398745393780224, 0.8479267027332893 },
-    [animdata_JointKey_RightLeg    ] = { -0.06007238709349325, -0.0027628100463820983, 0.5254134024079857 },
-    [animdata_JointKey_RightToeBase] = { -0.04405309798934153, 0.09181841609987569, 0.006423301541086168 },
-    [animdata_JointKey_RightToe_End] = { -0.13166587124041526, 0.061632392223766194, 0.011018984334520308 },
-    [animdata_JointKey_LeftLeg     ] = { 0.16611412671522532, -0.12065318111487834, 0.5251757184138375 },
-    [animdata_JointKey_LeftToeBase ] = { 0.23006849822727912, -0.13324157882513782, 0.00069305607416144 },
-    [animdata_JointKey_LeftToe_End ] = { 0.2701089351724764, -0.2165749355530251, 0.008479475276898355 },
-  }},
-  { .time = 0.3333333432674408, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.11550705909729005, 0.036374573707580564, 1.0163484954833986 },
-    [animdata_JointKey_RightArm    ] = { -0.00019475862261884915, 0.1291417475432067, 1.38900124484178 },
-    [animdata_JointKey_RightForeArm] = { -0.04446012230155249, 0.20213620277265634, 1.1239968875633661 },
-    [animdata_JointKey_RightHand   ] = { -0.13920228382819974, 0.16164138231591924, 0.8601101826234053 },
-    [animdata_JointKey_Neck        ] = { 0.13879984820784239, 0.07426038181700684, 1.4774602389642286 },
-    [animdata_JointKey_Head        ] = { 0.11872541390473246, 0.04677547318663175, 1.5689798245625592 },
-    [animdata_JointKey_LeftArm     ] = { 0.27784881408952, 0.01693190336937203, 1.3928707789398371 },
-    [animdata_JointKey_LeftForeArm ] = { 0.3520008918060049, 0.003079133958520699, 1.1248698829420023 },
-    [animdata_JointKey_LeftHand    ] = { 0.39419662088049806, -0.033885391157674645, 0.8471915917033258 },
-    [animdata_JointKey_RightLeg    ] = { -0.059089258066636015, 0.027339686774423548, 0.523110657648052 },
-    [animdata_JointKey_RightToeBase] = { -0.028500195148467675, 0.11630849712300233, 0.005224954909427489 },
-    [animdata_JointKey_RightToe_End] = { -0.11946367653066718, 0.09903073525287759, 0.011177996797671468 },
-    [animdata_JointKey_LeftLeg     ] = { 0.1623837043558922, -0.12099901802489321, 0.5249695340944102 },
-    [animdata_JointKey_LeftToeBase ] = { 0.23040008215704358, -0.13325442142732016, 0.0007298015989009521 },
-    [animdata_JointKey_LeftToe_End ] = { 0.2704403260865884, -0.2165880258670825, 0.008514570689139312 },
-  }},
-  { .time = 0.375, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.11189257621765136, 0.04594943046569824, 1.0175132751464844 },
-    [animdata_JointKey_RightArm    ] = { 0.008852034401673894, 0.15399843012996836, 1.3907968184336477 },
-    [animdata_JointKey_RightForeArm] = { -0.022487475027573103, 0.23283982935506906, 1.125623725005952 },
-    [animdata_JointKey_RightHand   ] = { -0.12491017601417717, 0.20820744615597675, 0.8626505007751615 },
-    [animdata_JointKey_Neck        ] = { 0.1438670038288126, 0.08796861497923826, 1.4777497382655642 },
-    [animdata_JointKey_Head        ] = { 0.12308108139685273, 0.06367278590321736, 1.5700096741231542 },
-    [animdata_JointKey_LeftArm     ] = { 0.275281580629461, 0.01644164069634004, 1.3917850337004996 },
-    [animdata_JointKey_LeftForeArm ] = { 0.34889646225092036, -0.008694157541157495, 1.1244576152847732 },
-    [animdata_JointKey_LeftHand    ] = { 0.38565276922263353, -0.056204636003954256, 0.8476114206163748 },
-    [animdata_JointKey_RightLeg    ] = { -0.05855967588942068, 0.05309642486981136, 0.52269282320645 },
-    [animdata_JointKey_RightToeBase] = { -0.031382258755759514, 0.1160238162121102, 0.004673094332313816 },
-    [animdata_JointKey_RightToe_End] = { -0.12365449876121817, 0.11067556440423157, 0.012768949575601775 },
-    [animdata_JointKey_LeftLeg     ] = { 0.1575786820123525, -0.11673812066900359, 0.5255736041615144 },
-    [animdata_JointKey_LeftToeBase ] = { 0.23067125628331614, -0.13320134909376283, 0.0008254065625250817 },
-    [animdata_JointKey_LeftToe_End ] = { 0.2707115773103716, -0.21653483320040678, 0.008611163210524167 },
-  }},
-  { .time = 0.4166666567325592, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.1055889892578125, 0.05756514072418213, 1.017100830078125 },
-    [animdata_JointKey_RightArm    ] = { 0.01653876990684225, 0.1750517615127248, 1.3918076153739438 },
-    [animdata_JointKey_RightForeArm] = { -0.0029191545817209086, 0.25577668137007015, 1.1260637521463641 },
-    [animdata_JointKey_RightHand   ] = { -0.10543914029553328, 0.24843889574136227, 0.8620790745096207 },
-    [animdata_JointKey_Neck        ] = { 0.14746743952877003, 0.09892042714276497, 1.47659807890239 },
-    [animdata_JointKey_Head        ] = { 0.12664973968272, 0.0767335122223063, 1.5693806302384141 },
-    [animdata_JointKey_LeftArm     ] = { 0.27031271835251786, 0.01547046562294991, 1.388768717005099 },
-    [animdata_JointKey_LeftForeArm ] = { 0.34020217404288317, -0.020522399082063256, 1.1216827887212986 },
-    [animdata_JointKey_LeftHand    ] = { 0.37116554507322363, -0.07663341281575328, 0.8457391018503202 },
-    [animdata_JointKey_RightLeg    ] = { -0.061148384499318205, 0.0715261264380551, 0.5225212143703225 },
-    [animdata_JointKey_RightToeBase] = { -0.03935197650009951, 0.11298243913114249, 0.006144380217267589 },
-    [animdata_JointKey_RightToe_End] = { -0.13130369533613617, 0.11695633280920338, 0.01786629180241708 },
-    [animdata_JointKey_LeftLeg     ] = { 0.15751462989000278, -0.12980728382876383, 0.5307327482924543 },
-    [animdata_JointKey_LeftToeBase ] = { 0.22181690391692627, -0.1373780475892021, 0.006563143987620422 },
-    [animdata_JointKey_LeftToe_End ] = { 0.2543227324136804, -0.22386144494264712, 0.015066498520682474 },
-  }},
-  { .time = 0.4583333432674408, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.09999488830566407, 0.06886539459228516, 1.0153304290771485 },
-    [animdata_JointKey_RightArm    ] = { 0.02513373895467277, 0.19359200893675166, 1.3921519661897344 },
-    [animdata_JointKey_RightForeArm] = { 0.015584046271494211, 0.27403360140544003, 1.125782180145603 },
-    [animdata_JointKey_RightHand   ] = { -0.0820349467566373, 0.28240789429867674, 0.8599768166399742 },
-    [animdata_JointKey_Neck        ] = { 0.15019777971169504, 0.10599735218619076, 1.4743770544123362 },
-    [animdata_JointKey_Head        ] = { 0.1294173201444037, 0.08504349525180968, 1.567454151711995 },
-    [animdata_JointKey_LeftArm     ] = { 0.2629519992239488, 0.011329359115169826, 1.3843624561537728 },
-    [animdata_JointKey_LeftForeArm ] = { 0.3274265096636011, -0.0347979095162119, 1.1174725694951513 },
-    [animdata_JointKey_LeftHand    ] = { 0.3507841237035219, -0.09822901005530264, 0.8423671434280697 },
-    [animdata_JointKey_RightLeg    ] = { -0.06537390054352675, 0.09417850836803025, 0.5213361298876649 },
-    [animdata_JointKey_RightToeBase] = { -0.046927322421775566, 0.11657235505285182, 0.0033940661183812716 },
-    [animdata_JointKey_RightToe_End] = { -0.13781832947672754, 0.13041202833102777, 0.015868107084976813 },
-    [animdata_JointKey_LeftLeg     ] = { 0.15637059219721625, -0.15719305396676084, 0.541700806880237 },
-    [animdata_JointKey_LeftToeBase ] = { 0.20727842224711387, -0.13992665575799865, 0.016191335568709705 },
-    [animdata_JointKey_LeftToe_End ] = { 0.22280995031560735, -0.23134550858943093, 0.019302508565974694 },
-  }},
-  { .time = 0.5, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.09395238876342774, 0.07847757339477539, 1.0159285736083985 },
-    [animdata_JointKey_RightArm    ] = { 0.03557796036608806, 0.21138650602602396, 1.3951026487167324 },
-    [animdata_JointKey_RightForeArm] = { 0.032297650573556415, 0.2897349936975377, 1.1279591361482182 },
-    [animdata_JointKey_RightHand   ] = { -0.05783677632435201, 0.31151493235767463, 0.8602774203966587 },
-    [animdata_JointKey_Neck        ] = { 0.15112616827937322, 0.10961682518872927, 1.474634448452496 },
-    [animdata_JointKey_Head        ] = { 0.12995802229720319, 0.08970662510677378, 1.5678531760952712 },
-    [animdata_JointKey_LeftArm     ] = { 0.2506137398905094, 0.003121921457133832, 1.3821191989115378 },
-    [animdata_JointKey_LeftForeArm ] = { 0.30804915255317517, -0.05285861603896651, 1.115506619342034 },
-    [animdata_JointKey_LeftHand    ] = { 0.3210882587451671, -0.12212764212019638, 0.8411275425539795 },
-    [animdata_JointKey_RightLeg    ] = { -0.06434912402446466, 0.11276380686801568, 0.5208640816478388 },
-    [animdata_JointKey_RightToeBase] = { -0.052012499298216934, 0.12182683252234082, 0.0008705102211568417 },
-    [animdata_JointKey_RightToe_End] = { -0.14120906321176704, 0.14399410490246778, 0.013555055603415475 },
-    [animdata_JointKey_LeftLeg     ] = { 0.1293388831810483, -0.18211381642421923, 0.5566428558824315 },
-    [animdata_JointKey_LeftToeBase ] = { 0.18696994229111158, -0.13101877806049353, 0.024033625529434027 },
-    [animdata_JointKey_LeftToe_End ] = { 0.1815000743592439, -0.22254272236244924, 0.00982932714507591 },
-  }},
-  { .time = 0.5416666865348816, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.0879398250579834, 0.08393294334411622, 1.0199258422851563 },
-    [animdata_JointKey_RightArm    ] = { 0.04898810495043272, 0.22508640748693498, 1.3998349519073483 },
-    [animdata_JointKey_RightForeArm] = { 0.05107142502091839, 0.2987791924301173, 1.131357874886797 },
-    [animdata_JointKey_RightHand   ] = { -0.027833706280299488, 0.33088325872190394, 0.861181274052365 },
-    [animdata_JointKey_Neck        ] = { 0.14896472053573984, 0.1074022880892143, 1.4785767189159649 },
-    [animdata_JointKey_Head        ] = { 0.12589032344699572, 0.08974013933764484, 1.5717961288585391 },
-    [animdata_JointKey_LeftArm     ] = { 0.23203172815816878, -0.011582035526728669, 1.3849901715954327 },
-    [animdata_JointKey_LeftForeArm ] = { 0.2802658531651296, -0.0769894846188661, 1.1187003852309965 },
-    [animdata_JointKey_LeftHand    ] = { 0.2835274732053442, -0.14967756319363115, 0.8449159818650902 },
-    [animdata_JointKey_RightLeg    ] = { -0.05379864504608558, 0.1304121994410153, 0.5218430364522004 },
-    [animdata_JointKey_RightToeBase] = { -0.053675130479407446, 0.12790112751505606, 0.001008692370212163 },
-    [animdata_JointKey_RightToe_End] = { -0.14045027159872325, 0.1576585703362524, 0.014896936411445452 },
-    [animdata_JointKey_LeftLeg     ] = { 0.08363343940650829, -0.18433371614537464, 0.5636960029514297 },
-    [animdata_JointKey_LeftToeBase ] = { 0.1477488703444145, -0.13001331353559767, 0.023016365204604056 },
-    [animdata_JointKey_LeftToe_End ] = { 0.11894537962867335, -0.21590454577196627, 0.0029821616806953257 },
-  }},
-  { .time = 0.5833333134651184, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.0813984775543213, 0.08365437507629395, 1.024432144165039 },
-    [animdata_JointKey_RightArm    ] = { 0.06438364823407555, 0.23262115574139358, 1.4029393401596957 },
-    [animdata_JointKey_RightForeArm] = { 0.07258030634388347, 0.2989521486087685, 1.1326655314324063 },
-    [animdata_JointKey_RightHand   ] = { 0.009050119600429056, 0.33664751059628534, 0.8591786569741701 },
-    [animdata_JointKey_Neck        ] = { 0.142117107860855, 0.10008975109742219, 1.4834312789365465 },
-    [animdata_JointKey_Head        ] = { 0.11619003571598624, 0.08625713680524853, 1.5765477833530448 },
-    [animdata_JointKey_LeftArm     ] = { 0.20647711346889935, -0.03079572884855743, 1.3908505129432893 },
-    [animdata_JointKey_LeftForeArm ] = { 0.2425327907987172, -0.1038163964153447, 1.1246121065949881 },
-    [animdata_JointKey_LeftHand    ] = { 0.2378832819360589, -0.1773125627383555, 0.8510635858324069 },
-    [animdata_JointKey_RightLeg    ] = { -0.03741447157737242, 0.1426438651291826, 0.5228464116400674 },
-    [animdata_JointKey_RightToeBase] = { -0.054524152264656844, 0.13045752429415575, 0.0010475061644709882 },
-    [animdata_JointKey_RightToe_End] = { -0.13989396374006968, 0.16371596457522336, 0.015682574894532876 },
-    [animdata_JointKey_LeftLeg     ] = { 0.035431761319291155, -0.16944700821733633, 0.5623354152917569 },
-    [animdata_JointKey_LeftToeBase ] = { 0.09872604064029336, -0.1437609967441839, 0.01631540625304506 },
-    [animdata_JointKey_LeftToe_End ] = { 0.049470625412310884, -0.22067722893554872, 0.0000024736656306023617 },
-  }},
-  { .time = 0.625, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.07279083251953125, 0.0791013240814209, 1.0291172790527343 },
-    [animdata_JointKey_RightArm    ] = { 0.07518331518359228, 0.23156570944801774, 1.4070479334887656 },
-    [animdata_JointKey_RightForeArm] = { 0.08636277928706257, 0.29286701184943087, 1.1356956105939071 },
-    [animdata_JointKey_RightHand   ] = { 0.037851906196183116, 0.3331163919721004, 0.8595094879746553 },
-    [animdata_JointKey_Neck        ] = { 0.1307629308390676, 0.08888700744894658, 1.488657448442875 },
-    [animdata_JointKey_Head        ] = { 0.10280838569479726, 0.07817067332104925, 1.5815979735235308 },
-    [animdata_JointKey_LeftArm     ] = { 0.17824720108376887, -0.04950729111623226, 1.3965132871528483 },
-    [animdata_JointKey_LeftForeArm ] = { 0.20084402912817695, -0.12389591053160082, 1.1291733956495982 },
-    [animdata_JointKey_LeftHand    ] = { 0.1883291388322121, -0.19351083984149842, 0.8548574847005295 },
-    [animdata_JointKey_RightLeg    ] = { -0.02573503363683149, 0.14506559839661484, 0.525054230734342 },
-    [animdata_JointKey_RightToeBase] = { -0.05471078921995189, 0.13184365392367361, 0.0009361847757282682 },
-    [animdata_JointKey_RightToe_End] = { -0.13914373778474662, 0.1673328621058271, 0.015765443312466883 },
-    [animdata_JointKey_LeftLeg     ] = { -0.0029643945541915607, -0.1472820892981649, 0.5583509926369254 },
-    [animdata_JointKey_LeftToeBase ] = { 0.04718121760876875, -0.17561122118219039, 0.010606986788594615 },
-    [animdata_JointKey_LeftToe_End ] = { -0.013034173138527106, -0.24539634760427714, 0.000002436976366102517 },
-  }},
-  { .time = 0.6666666865348816, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.06192971229553223, 0.07047377109527588, 1.0316754150390626 },
-    [animdata_JointKey_RightArm    ] = { 0.07442915192040425, 0.2225551992338938, 1.4098038391739578 },
-    [animdata_JointKey_RightForeArm] = { 0.08509385532028084, 0.28224156874188383, 1.138071062634088 },
-    [animdata_JointKey_RightHand   ] = { 0.04743610983521704, 0.3220886742966041, 0.8601390885612537 },
-    [animdata_JointKey_Neck        ] = { 0.11563758151407592, 0.07531692924194762, 1.4918278970872763 },
-    [animdata_JointKey_Head        ] = { 0.08657724582588597, 0.06587400647125578, 1.584567132077898 },
-    [animdata_JointKey_LeftArm     ] = { 0.15328121217931404, -0.06618215530130943, 1.3995209986012023 },
-    [animdata_JointKey_LeftForeArm ] = { 0.1666652571428688, -0.13625078497323792, 1.1303998925826644 },
-    [animdata_JointKey_LeftHand    ] = { 0.14874598651948032, -0.19862406972296143, 0.8546453519986699 },
-    [animdata_JointKey_RightLeg    ] = { -0.021823590009940216, 0.1388987428887702, 0.526581606922808 },
-    [animdata_JointKey_RightToeBase] = { -0.054932019483070346, 0.13266335757480827, 0.000788521462900178 },
-    [animdata_JointKey_RightToe_End] = { -0.13858989810488465, 0.17009916273942183, 0.01521884077214565 },
-    [animdata_JointKey_LeftLeg     ] = { -0.028547685844760605, -0.13356883712930878, 0.554377249800338 },
-    [animdata_JointKey_LeftToeBase ] = { -0.02363250995507201, -0.20579261191551015, 0.011698744619309594 },
-    [animdata_JointKey_LeftToe_End ] = { -0.09490558595388728, -0.26507187981332736, 0.007899954325256477 },
-  }},
-  { .time = 0.7083333134651184, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.047683362960815434, 0.0591904878616333, 1.0320752716064454 },
-    [animdata_JointKey_RightArm    ] = { 0.06810472183123432, 0.2120315453892149, 1.4095834198517134 },
-    [animdata_JointKey_RightForeArm] = { 0.0792765813824524, 0.26919048942220314, 1.1373281195043863 },
-    [animdata_JointKey_RightHand   ] = { 0.048053964475307895, 0.3045093754011085, 0.8579899598474093 },
-    [animdata_JointKey_Neck        ] = { 0.09666033817628082, 0.0626748361819581, 1.4927876894031784 },
-    [animdata_JointKey_Head        ] = { 0.06646141447752851, 0.05548156710264303, 1.585364789979823 },
-    [animdata_JointKey_LeftArm     ] = { 0.12412049092521284, -0.08181782661087786, 1.4008893161322182 },
-    [animdata_JointKey_LeftForeArm ] = { 0.13147631487924039, -0.14628745926182096, 1.1301413187670541 },
-    [animdata_JointKey_LeftHand    ] = { 0.11117507133900745, -0.20151453256866966, 0.8530313623523579 },
-    [animdata_JointKey_RightLeg    ] = { -0.022793692046262377, 0.12985243385086523, 0.5262458331676345 },
-    [animdata_JointKey_RightToeBase] = { -0.055396729210281014, 0.13315517525923654, 0.0004100145926288867 },
-    [animdata_JointKey_RightToe_End] = { -0.13840906131244612, 0.1723377424060248, 0.013900496462766235 },
-    [animdata_JointKey_LeftLeg     ] = { -0.0531312334534142, -0.13461300479715568, 0.5524601309338941 },
-    [animdata_JointKey_LeftToeBase ] = { -0.1067996634394748, -0.20494727887351857, 0.014506359831294252 },
-    [animdata_JointKey_LeftToe_End ] = { -0.18426884833174104, -0.25504565063929024, 0.024354812053459032 },
-  }},
-  { .time = 0.75, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.030922155380249023, 0.046095051765441895, 1.0292241668701172 },
-    [animdata_JointKey_RightArm    ] = { 0.05885955425570108, 0.20221606570336595, 1.4045560955225886 },
-    [animdata_JointKey_RightForeArm] = { 0.06999180878994733, 0.25433028847083455, 1.1312886468417334 },
-    [animdata_JointKey_RightHand   ] = { 0.041216100322935774, 0.2807104722702263, 0.8507032934821516 },
-    [animdata_JointKey_Neck        ] = { 0.07687373078416825, 0.052944012576312816, 1.4902139085119306 },
-    [animdata_JointKey_Head        ] = { 0.045967813249128985, 0.049379046283562315, 1.5827685028674479 },
-    [animdata_JointKey_LeftArm     ] = { 0.09368832779129865, -0.09477873039606699, 1.4002221149734118 },
-    [animdata_JointKey_LeftForeArm ] = { 0.09535833303804539, -0.1543091937470462, 1.128251073021516 },
-    [animdata_JointKey_LeftHand    ] = { 0.07455161264032562, -0.2048371454896212, 0.8502832723979142 },
-    [animdata_JointKey_RightLeg    ] = { -0.03832199272608902, 0.12199859993356035, 0.5241330654056627 },
-    [animdata_JointKey_RightToeBase] = { -0.056007576173502924, 0.13327129750129849, 0.000009316105461021352 },
-    [animdata_JointKey_RightToe_End] = { -0.13855662333620053, 0.17392242148680723, 0.01190278780150814 },
-    [animdata_JointKey_LeftLeg     ] = { -0.06891703936264999, -0.13305462976534863, 0.5436827583463196 },
-    [animdata_JointKey_LeftToeBase ] = { -0.17078715842309333, -0.20071245437781046, 0.017290223690295255 },
-    [animdata_JointKey_LeftToe_End ] = { -0.25579191488938846, -0.23143551660505787, 0.038232966510569566 },
-  }},
-  { .time = 0.7916666865348816, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.015021650791168214, 0.03268787860870361, 1.0270296478271486 },
-    [animdata_JointKey_RightArm    ] = { 0.04845338943435033, 0.1893563831883776, 1.4005841410691204 },
-    [animdata_JointKey_RightForeArm] = { 0.05627717968272109, 0.2381383328990229, 1.1265877416737835 },
-    [animdata_JointKey_RightHand   ] = { 0.027986683204448113, 0.25802515801929454, 0.8454182929250313 },
-    [animdata_JointKey_Neck        ] = { 0.060629548881479096, 0.04084941774492755, 1.488012164987362 },
-    [animdata_JointKey_Head        ] = { 0.029839904259689545, 0.040077890474542244, 1.5806708948903623 },
-    [animdata_JointKey_LeftArm     ] = { 0.06978585713331452, -0.10893931189883223, 1.4000559411700726 },
-    [animdata_JointKey_LeftForeArm ] = { 0.06591763248213424, -0.16193537253409127, 1.1267587491909918 },
-    [animdata_JointKey_LeftHand    ] = { 0.04504449452613885, -0.20719551155696309, 0.8478897634345487 },
-    [animdata_JointKey_RightLeg    ] = { -0.05000000824135638, 0.11318531315775905, 0.5226508669043008 },
-    [animdata_JointKey_RightToeBase] = { -0.056548434142295836, 0.13297220671074034, 0.000009601091815643059 },
-    [animdata_JointKey_RightToe_End] = { -0.13873423457369613, 0.17461483619084497, 0.010950327186518583 },
-    [animdata_JointKey_LeftLeg     ] = { -0.08216467014011088, -0.12782217390337666, 0.5349011591860268 },
-    [animdata_JointKey_LeftToeBase ] = { -0.18223072339174087, -0.19559524986747, 0.009948937939425289 },
-    [animdata_JointKey_LeftToe_End ] = { -0.2710510508500128, -0.2170634819409516, 0.02602308964929696 },
-  }},
-  { .time = 0.8333333134651184, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.00173012375831604, 0.020169892311096192, 1.0294622802734374 },
-    [animdata_JointKey_RightArm    ] = { 0.04072263755774201, 0.17618953917026148, 1.4019287082518208 },
-    [animdata_JointKey_RightForeArm] = { 0.04365748018119844, 0.2230241369964335, 1.127496900692671 },
-    [animdata_JointKey_RightHand   ] = { 0.015751697439918888, 0.24104564929934424, 0.8461633253488166 },
-    [animdata_JointKey_Neck        ] = { 0.04717195891889378, 0.028531878959013938, 1.4903720532617348 },
-    [animdata_JointKey_Head        ] = { 0.01643895698242403, 0.030622784017935372, 1.5830292083430164 },
-    [animdata_JointKey_LeftArm     ] = { 0.048476680993164836, -0.12289723242918395, 1.4045009156483323 },
-    [animdata_JointKey_LeftForeArm ] = { 0.04200081247500144, -0.16925677765605776, 1.1300491648871838 },
-    [animdata_JointKey_LeftHand    ] = { 0.02314131573680659, -0.2090448742387713, 0.850204004779583 },
-    [animdata_JointKey_RightLeg    ] = { -0.045461194641838745, 0.10315947510599621, 0.5241166477921501 },
-    [animdata_JointKey_RightToeBase] = { -0.056561599359513666, 0.13239086383089363, 0.000011693900853284589 },
-    [animdata_JointKey_RightToe_End] = { -0.1384313917791516, 0.17469497535129755, 0.010782641551737849 },
-    [animdata_JointKey_LeftLeg     ] = { -0.08980285444979559, -0.12920146250903983, 0.532075313660494 },
-    [animdata_JointKey_LeftToeBase ] = { -0.18015608083495366, -0.1965239506292762, 0.0014869185607615165 },
-    [animdata_JointKey_LeftToe_End ] = { -0.2702292994687245, -0.2173685685450355, 0.00927354054756089 },
-  }},
-  { .time = 0.875, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { -0.0087956440448761, 0.006631211042404175, 1.0321363830566406 },
-    [animdata_JointKey_RightArm    ] = { 0.044704070574591574, 0.15702329647283264, 1.4061292441687883 },
-    [animdata_JointKey_RightForeArm] = { 0.040299143483483874, 0.20243335606085805, 1.131477766450352 },
-    [animdata_JointKey_RightHand   ] = { 0.009122273471202088, 0.22330881283081344, 0.8506854780157704 },
-    [animdata_JointKey_Neck        ] = { 0.03797084464254934, 0.009136659640578706, 1.4928665354116502 },
-    [animdata_JointKey_Head        ] = { 0.00816870672741465, 0.01433389195399582, 1.5857054224217817 },
-    [animdata_JointKey_LeftArm     ] = { 0.025909594698525086, -0.1419016255332704, 1.4066998984329502 },
-    [animdata_JointKey_LeftForeArm ] = { 0.016117553840581937, -0.18260822171665178, 1.1314509203813317 },
-    [animdata_JointKey_LeftHand    ] = { -0.0016488108888250365, -0.21805055251143493, 0.8509508543139472 },
-    [animdata_JointKey_RightLeg    ] = { -0.03486569921458512, 0.09332811508485664, 0.5263311274824076 },
-    [animdata_JointKey_RightToeBase] = { -0.05625903904236573, 0.13235535042990734, 0.000008818355420618928 },
-    [animdata_JointKey_RightToe_End] = { -0.13788814658722615, 0.17498488999210654, 0.011310354581925584 },
-    [animdata_JointKey_LeftLeg     ] = { -0.10381964623745785, -0.12448653377173162, 0.5307369509669888 },
-    [animdata_JointKey_LeftToeBase ] = { -0.1804166686679027, -0.19612824482635793, 0.0013292150436844884 },
-    [animdata_JointKey_LeftToe_End ] = { -0.2704858000035371, -0.21696316199605542, 0.009188680200829776 },
-  }},
+/* cooked by anim_cooker from joints/turn90_right.txt: 22 of 22 keys kept at 0.001m tolerance */
+
+float animdata_turn90_right_key_times[] = {
+  0, 0.0416666679, 0.0833333358, 0.125, 0.166666672, 0.208333328, 0.25, 0.291666657,
+  0.333333343, 0.375, 0.416666657, 0.458333343, 0.5, 0.541666687, 0.583333313, 0.625,
+  0.666666687, 0.708333313, 0.75, 0.791666687, 0.833333313, 0.875,
+};
+
+uint16_t animdata_turn90_right_keys[] = {
+  /* joint  0 x */ 27127, 27992, 30044, 32567, 34706, 36178, 37224, 37872, 38081, 37725, 37104, 36553, 35957, 35365, 34721, 33873, 32803, 31399, 29748, 28182, 26872, 25835,
+  /* joint  0 y */ 27385, 28011, 29068, 29931, 30712, 31259, 31689, 32154, 32831, 33874, 35139, 36370, 37417, 38011, 37981, 37485, 36545, 35316, 33890, 32430, 31067, 29592,
+  /* joint  0 z */ 42680, 42514, 42258, 42196, 42232, 42181, 42075, 41980, 41960, 42008, 41991, 41918, 41943, 42108, 42294, 42487, 42593, 42609, 42492, 42401, 42501, 42612,
+  /* joint  1 x */ 12208, 13389, 15811, 18492, 20723, 22574, 24205, 25540, 26683, 27574, 28331, 29178, 30207, 31528, 33044, 34108, 34034, 33411, 32500, 31475, 30714, 31106,
+  /* joint  1 y */ 30124, 31435, 33002, 34385, 35881, 37410, 38941, 40558, 42935, 45642, 47935, 49954, 51892, 53385, 54205, 54090, 53109, 51963, 50894, 49493, 48059, 45972,
+  /* joint  1 z */ 57746, 57611, 57413, 57369, 57407, 57410, 57378, 57345, 57345, 57419, 57461, 57475, 57597, 57792, 57920, 58090, 58204, 58195, 57987, 57823, 57879, 58052,
+  /* joint  2 x */  8057,  8948, 10825, 13057, 14997, 16600, 18264, 20081, 22322, 24487, 26414, 28237, 29884, 31733, 33852, 35210, 35085, 34512, 33597, 32246, 31003, 30672,
+  /* joint  2 y */ 28149, 29471, 31382, 33674, 36661, 40136, 43710, 47165, 50885, 54229, 56727, 58716, 60426, 61411, 61429, 60767, 59609, 58188, 56570, 54806, 53160, 50917,
+  /* joint  2 z */ 46409, 46292, 46127, 46106, 46169, 46239, 46303, 46363, 46404, 46471, 46490, 46478, 46568, 46708, 46762, 46887, 46985, 46955, 46705, 46511, 46549, 46713,
+  /* joint  3 x */  6492,  7285,  8598, 10135, 11264, 11650, 11799, 12063, 12989, 14397, 16315, 18620, 21004, 23960, 27593, 30431, 31375, 31436, 30762, 29459, 28254, 27600,
+  /* joint  3 y */ 24060, 24643, 25847, 27603, 30259, 33648, 37423, 41495, 46475, 51546, 55928, 59628, 62798, 64907, 65535, 65150, 63949, 62035, 59443, 56972, 55123, 53191,
+  /* joint  3 z */ 34835, 34762, 34659, 34704, 34836, 34995, 35178, 35368, 35510, 35615, 35591, 35504, 35517, 35554, 35471, 35485, 35511, 35422, 35121, 34903, 34934, 35121,
+  /* joint  4 x */ 26348, 27671, 30209, 32885, 35025, 36808, 38369, 39574, 40375, 40874, 41229, 41498, 41590, 41377, 40702, 39584, 38094, 36224, 34275, 32675, 31349, 30442,
+  /* joint  4 y */ 32508, 32779, 33366, 33716, 34147, 34623, 35190, 35851, 36958, 38451, 39643, 40414, 40808, 40567, 39771, 38551, 37073, 35696, 34636, 33319, 31977, 29865,
+  /* joint  4 z */ 61695, 61546, 61310, 61263, 61307, 61258, 61147, 61040, 60997, 61009, 60961, 60870, 60880, 61043, 61244, 61459, 61590, 61630, 61524, 61433, 61530, 61633,
+  /* joint  5 x */ 26313, 27401, 29678, 31977, 33715, 35231, 36655, 37755, 38398, 38827, 39178, 39451, 39504, 39104, 38148, 36830, 35231, 33249, 31230, 29641, 28321, 27507,
+  /* joint  5 y */ 29271, 29452, 29873, 30036, 30372, 30903, 31641, 32524, 33964, 35805, 37227, 38132, 38640, 38644, 38264, 37384, 36044, 34912, 34248, 33235, 32205, 30431,
+  /* joint  5 z */ 65535, 65373, 65111, 65026, 65036, 64977, 64878, 64792, 64775, 64818, 64792, 64712, 64729, 64892, 65088, 65296, 65419, 65452, 65345, 65258, 65355, 65466,
+  /* joint  6 x */ 41380, 42750, 45258, 47928, 50045, 51663, 52946, 53804, 54073, 53820, 53331, 52606, 51390, 49560, 47042, 44261, 41802, 38929, 35931, 33577, 31477, 29254,
+  /* joint  6 y */ 34450, 33789, 33561, 33105, 32625, 32032, 31517, 31100, 30714, 30660, 30555, 30104, 29210, 27608, 25516, 23478, 21662, 19959, 18547, 17005, 15485, 13415,
+  /* joint  6 z */ 58437, 58280, 58009, 57972, 58041, 57953, 57767, 57589, 57505, 57460, 57335, 57153, 57061, 57179, 57421, 57655, 57779, 57836, 57808, 57801, 57985, 58076,
+  /* joint  7 x */ 45232, 46908, 49809, 53212, 56197, 58354, 59873, 60898, 61378, 61072, 60216, 58957, 57048, 54311, 50594, 46487, 43120, 39654, 36096, 33196, 30839, 28290,
+  /* joint  7 y */ 34021, 33694, 33907, 33869, 33530, 32640, 31547, 30530, 29205, 27923, 26635, 25080, 23113, 20485, 17563, 15376, 14030, 12937, 12063, 11233, 10435,  8981,
+  /* joint  7 z */ 47058, 46919, 46675, 46697, 46844, 46808, 46645, 46488, 46440, 46423, 46309, 46135, 46054, 46186, 46430, 46618, 46669, 46658, 46580, 46518, 46654, 46712,
+  /* joint  8 x */ 48803, 50643, 53729, 57617, 61199, 63586, 64919, 65522, 65535, 64693, 63266, 61258, 58333, 54633, 50136, 45255, 41355, 37654, 34046, 31139, 28982, 26539,
+  /* joint  8 y */ 32901, 32758, 33178, 33298, 32876, 31500, 29581, 27628, 25179, 22748, 20523, 18171, 15568, 12568,  9558,  7794,  7237,  6922,  6560,  6303,  6102,  5121,
+  /* joint  8 z */ 35466, 35334, 35098, 35150, 35341, 35328, 35167, 35007, 34976, 34994, 34916, 34777, 34726, 34882, 35136, 35293, 35284, 35217, 35104, 35005, 35101, 35132,
+  /* joint  9 x */ 18900, 18680, 18533, 18916, 19110, 19572, 20566, 20784, 20881, 20933, 20678, 20262, 20363, 21402, 23016, 24167, 24552, 24456, 22927, 21776, 22223, 23267,
+  /* joint  9 y */ 24083, 22823, 20268, 20770, 22729, 25211, 26835, 28569, 31847, 34653, 36660, 39127, 41151, 43073, 44406, 44669, 43998, 43012, 42157, 41197, 40105, 39034,
+  /* joint  9 z */ 21793, 21719, 21762, 21866, 21976, 21910, 21777, 21692, 21597, 21579, 21572, 21523, 21504, 21544, 21586, 21677, 21740, 21726, 21639, 21578, 21638, 21730,
+  /* joint 10 x */ 15159, 14948, 13583, 12466, 12906, 16965, 20173, 22362, 23894, 23610, 22825, 22079, 21578, 21414, 21331, 21312, 21290, 21245, 21184, 21131, 21130, 21160,
+  /* joint 10 y */ 19761, 19760, 21232, 24556, 28081, 31992, 36441, 38870, 41537, 41506, 41175, 41566, 42138, 42800, 43078, 43229, 43318, 43372, 43385, 43352, 43289, 43285,
+  /* joint 10 z */     0,     0,    97,   158,   225,   213,   257,   265,   216,   193,   254,   140,    36,    42,    43,    39,    32,    17,     0,     0,     0,     0,
+  /* joint 11 x */ 12810, 12570, 10492,  8015,  7056,  9793, 11947, 13731, 14933, 14520, 13767, 13125, 12791, 12866, 12921, 12994, 13049, 13067, 13052, 13035, 13065, 13118,
+  /* joint 11 y */ 10080, 10089, 11757, 15738, 20324, 25745, 32061, 35582, 39655, 40924, 41608, 43073, 44553, 46041, 46701, 47094, 47396, 47640, 47812, 47888, 47896, 47928,
+  /* joint 11 z */   486,   492,   401,   292,   352,   391,   432,   455,   461,   527,   738,   655,   560,   615,   647,   651,   628,   574,   491,   452,   445,   467,
+  /* joint 12 x */ 40760, 41401, 42328, 42924, 43368, 43485, 43352, 43066, 42699, 42225, 42219, 42106, 39443, 34941, 30192, 26410, 23890, 21468, 19913, 18608, 17855, 16474,
+  /* joint 12 y */ 20107, 18764, 17140, 16652, 16858, 16637, 16142, 15729, 15691, 16155, 14732, 11749,  9035,  8793, 10415, 12829, 14322, 14209, 14378, 14948, 14798, 15312,
+  /* joint 12 z */ 21880, 21831, 21753, 21735, 21762, 21751, 21716, 21682, 21673, 21698, 21911, 22364, 22981, 23272, 23216, 23051, 22887, 22808, 22446, 22083, 21967, 21911,
+  /* joint 13 x */ 49417, 49395, 49387, 49367, 49362, 49358, 49358, 49366, 49399, 49426, 48553, 47121, 45121, 41257, 36428, 31350, 24374, 16181,  9877,  8750,  8954,  8929,
+  /* joint 13 y */ 14372, 14355, 14353, 14342, 14351, 14353, 14355, 14358, 14357, 14362, 13908, 13630, 14600, 14710, 13212,  9743,  6456,  6548,  7010,  7567,  7466,  7509,
+  /* joint 13 z */    53,    36,    20,    20,    27,    28,    28,    29,    30,    34,   271,   668,   992,   950,   673,   438,   483,   599,   714,   411,    61,    55,
+  /* joint 14 x */ 53362, 53340, 53331, 53312, 53307, 53303, 53302, 53311, 53344, 53370, 51756, 48651, 44582, 38419, 31575, 25418, 17352,  8549,  1503,     0,    81,    56,
+  /* joint 14 y */  5296,  5279,  5277,  5266,  5275,  5277,  5279,  5282,  5281,  5286,  4488,  3673,  4632,  5355,  4835,  2143,     0,  1092,  3663,  5229,  5196,  5240,
+  /* joint 14 z */   374,   358,   342,   341,   348,   350,   350,   350,   351,   355,   622,   797,   406,   123,     0,     0,   326,  1005,  1578,  1074,   383,   379,
+};
+
+animdata_Clip animdata_turn90_right_clip = {
+  .duration  = 0.916666687,
+  .key_count = 22,
+  .key_times = animdata_turn90_right_key_times,
+  .min       = { -0.271051049, -0.265071869, 2.43697627e-06 },
+  .extent    = { 0.665247679, 0.601719379, 1.58737576 },
+  .keys      = animdata_turn90_right_keys,
 };
@@ -1,411 +1,64 @@
-float animdata_walk_duration = 1;
-animdata_Frame animdata_walk_frames[] = {
-  { .time = 0, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.0003456747531890869, -0.015296831130981446, 1.0161539459228517 },
-    [animdata_JointKey_RightArm    ] = { -0.1423450719941006, 0.02347072890076369, 1.384242525517638 },
-    [animdata_JointKey_RightForeArm] = { -0.22818200261029714, 0.07763549798609723, 1.1249874135966134 },
-    [animdata_JointKey_RightHand   ] = { -0.24622931635685327, 0.02130289187306799, 0.8479436607934097 },
-    [animdata_JointKey_Neck        ] = { 0.005675431939839781, 0.0202040083897049, 1.477632577882227 },
-    [animdata_JointKey_Head        ] = { 0.009420904565385732, 0.00020799759723365784, 1.5731335502665735 },
-    [animdata_JointKey_LeftArm     ] = { 0.1529107305884156, 0.032387502076628015, 1.38434989936219 },
-    [animdata_JointKey_LeftForeArm ] = { 0.25473069645417334, 0.021797427657732557, 1.1254375981127138 },
-    [animdata_JointKey_LeftHand    ] = { 0.2713517363606685, -0.11911093260249947, 0.880242040121923 },
-    [animdata_JointKey_RightLeg    ] = { -0.07233558674114815, -0.09822980772074039, 0.5191363425953159 },
-    [animdata_JointKey_RightToeBase] = { -0.040188921608178635, -0.09942408753049092, 0.0001513287943332209 },
-    [animdata_JointKey_RightToe_End] = { -0.03645700350490169, -0.1917920287962547, 0.008062630200648369 },
-    [animdata_JointKey_LeftLeg     ] = { 0.128246488320931, -0.1769470270381672, 0.5444846142975751 },
-    [animdata_JointKey_LeftToeBase ] = { 0.09768943380890555, 0.09435741327070726, 0.08381409296894106 },
-    [animdata_JointKey_LeftToe_End ] = { 0.11023445460141056, 0.01914138164196217, 0.030960012582506486 },
-  }},
-  { .time = 0.0416666679084301, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { -0.0015299874544143677, -0.012306033372879029, 1.0229083251953126 },
-    [animdata_JointKey_RightArm    ] = { -0.14150894417678406, 0.022983509017894716, 1.3958235602242517 },
-    [animdata_JointKey_RightForeArm] = { -0.23700825370616613, 0.06463322299542588, 1.1376371990508036 },
-    [animdata_JointKey_RightHand   ] = { -0.25437396454136313, -0.05986823280524829, 0.8837669028684623 },
-    [animdata_JointKey_Neck        ] = { 0.008964055157932384, 0.022222843787333076, 1.4844255311826167 },
-    [animdata_JointKey_Head        ] = { 0.012822427995629018, 0.000869599748528862, 1.5796277196197293 },
-    [animdata_JointKey_LeftArm     ] = { 0.15470070859479382, 0.03832541262536696, 1.3900466530984354 },
-    [animdata_JointKey_LeftForeArm ] = { 0.24412295975565226, 0.06174891945425236, 1.1274251914455762 },
-    [animdata_JointKey_LeftHand    ] = { 0.26819460153529984, -0.049187961520723265, 0.8678758710652672 },
-    [animdata_JointKey_RightLeg    ] = { -0.07552314883207015, -0.04813998014012125, 0.5183939149955534 },
-    [animdata_JointKey_RightToeBase] = { -0.03998779075710253, -0.020626771204529798, 0.0005071946003942784 },
-    [animdata_JointKey_RightToe_End] = { -0.03830597789487533, -0.11333656191807627, 0.003734973522299297 },
-    [animdata_JointKey_LeftLeg     ] = { 0.11728195167570524, -0.20864799789092395, 0.5663684941621301 },
-    [animdata_JointKey_LeftToeBase ] = { 0.10582798615121318, -0.06585073282450202, 0.05529082320267694 },
-    [animdata_JointKey_LeftToe_End ] = { 0.1270293140977621, -0.15280638728817933, 0.030844983828560393 },
-  }},
-  { .time = 0.0833333358168602, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { -0.002490820586681366, -0.009774454236030579, 1.0208985900878906 },
-    [animdata_JointKey_RightArm    ] = { -0.1402077312976169, 0.02284346317970707, 1.3978826299910676 },
-    [animdata_JointKey_RightForeArm] = { -0.24802732756281726, 0.032337775031572105, 1.141367886676544 },
-    [animdata_JointKey_RightHand   ] = { -0.26037953136859515, -0.13766441527585754, 0.9150959429085964 },
-    [animdata_JointKey_Neck        ] = { 0.011972383105815677, 0.02409107572103273, 1.482406227410838 },
-    [animdata_JointKey_Head        ] = { 0.015390050967983487, 0.0009370519334353977, 1.5772034608663221 },
-    [animdata_JointKey_LeftArm     ] = { 0.15635824610384536, 0.04393097865641409, 1.386766570483143 },
-    [animdata_JointKey_LeftForeArm ] = { 0.23636107630845218, 0.0982468712205608, 1.1256835180304068 },
-    [animdata_JointKey_LeftHand    ] = { 0.2581138528129577, 0.018200433431882993, 0.8548114672746496 },
-    [animdata_JointKey_RightLeg    ] = { -0.0807313790920215, -0.002665527104183745, 0.5136301405638204 },
-    [animdata_JointKey_RightToeBase] = { -0.03981504100595525, 0.05776510294798648, 0.00046973804083652484 },
-    [animdata_JointKey_RightToe_End] = { -0.039772970438197615, -0.03501492182313801, 0.0000037117504551865274 },
-    [animdata_JointKey_LeftLeg     ] = { 0.10660092355481428, -0.2274517863269699, 0.5744806354990862 },
-    [animdata_JointKey_LeftToeBase ] = { 0.11434363245278634, -0.23038454176061657, 0.04653224653339054 },
-    [animdata_JointKey_LeftToe_End ] = { 0.13682834758186985, -0.3203373245079571, 0.04989629528804734 },
-  }},
-  { .time = 0.125, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { -0.002954259514808655, -0.0061900150775909425, 1.0124620819091796 },
-    [animdata_JointKey_RightArm    ] = { -0.1396645867002555, 0.02385879181413781, 1.3923142418077559 },
-    [animdata_JointKey_RightForeArm] = { -0.2539069414997507, -0.005265443178500124, 1.1400931736045872 },
-    [animdata_JointKey_RightHand   ] = { -0.26387687667435233, -0.2058704871784841, 0.940316997055389 },
-    [animdata_JointKey_Neck        ] = { 0.01360880767130145, 0.02683493589659424, 1.4740008293351021 },
-    [animdata_JointKey_Head        ] = { 0.016417877277097977, 0.0017663289172311681, 1.5683299278003753 },
-    [animdata_JointKey_LeftArm     ] = { 0.1573479338717695, 0.048767231693576475, 1.3783213160267922 },
-    [animdata_JointKey_LeftForeArm ] = { 0.22557858516804394, 0.12744259995671628, 1.1201163728548609 },
-    [animdata_JointKey_LeftHand    ] = { 0.24415753811678087, 0.0798848159341039, 0.8414671985396137 },
-    [animdata_JointKey_RightLeg    ] = { -0.0857532126778278, 0.04028981324643315, 0.5057124250850697 },
-    [animdata_JointKey_RightToeBase] = { -0.03970855122337038, 0.13681294441433198, 0.00035046555383573265 },
-    [animdata_JointKey_RightToe_End] = { -0.040954480605353984, 0.04404075358368741, 0.0000037310791031030384 },
-    [animdata_JointKey_LeftLeg     ] = { 0.09816469281297405, -0.23791212815077592, 0.5737410682850888 },
-    [animdata_JointKey_LeftToeBase ] = { 0.11790089224980989, -0.3769906624046284, 0.06081125182349997 },
-    [animdata_JointKey_LeftToe_End ] = { 0.13425294940837748, -0.46524870537838214, 0.08429551322349514 },
-  }},
-  { .time = 0.1666666716337204, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { -0.002438637763261795, -0.0014990758895874023, 1.00028564453125 },
-    [animdata_JointKey_RightArm    ] = { -0.13849768745480542, 0.024908085659216504, 1.383345045838863 },
-    [animdata_JointKey_RightForeArm] = { -0.25168286249823857, -0.039923207070577386, 1.1373754718399525 },
-    [animdata_JointKey_RightHand   ] = { -0.2625694922708653, -0.25859377610316064, 0.9576062591161275 },
-    [animdata_JointKey_Neck        ] = { 0.015891494475600322, 0.030317743882663936, 1.4618466039372604 },
-    [animdata_JointKey_Head        ] = { 0.017686212756884156, 0.003698988249491224, 1.5557749041918567 },
-    [animdata_JointKey_LeftArm     ] = { 0.15881341520932488, 0.053643492145190264, 1.3656785222280985 },
-    [animdata_JointKey_LeftForeArm ] = { 0.2136811752123534, 0.1505737268182607, 1.1105137163880998 },
-    [animdata_JointKey_LeftHand    ] = { 0.23039772664384392, 0.1311872419155905, 0.8283843193644712 },
-    [animdata_JointKey_RightLeg    ] = { -0.09038867588099757, 0.07569271155381621, 0.4960531547419308 },
-    [animdata_JointKey_RightToeBase] = { -0.03916758468649063, 0.21770507920068205, 0.0009345140455165258 },
-    [animdata_JointKey_RightToe_End] = { -0.04149011533533536, 0.1249576167728356, 0.000003483023941154989 },
-    [animdata_JointKey_LeftLeg     ] = { 0.08958940275677403, -0.25001029246080564, 0.5725190867086364 },
-    [animdata_JointKey_LeftToeBase ] = { 0.1143659459416239, -0.4894682143721273, 0.09442646694312021 },
-    [animdata_JointKey_LeftToe_End ] = { 0.13102108591908918, -0.5714563985261639, 0.1345378936943252 },
-  }},
-  { .time = 0.2083333283662796, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { -0.00029424816370010376, 0.0007174789905548096, 0.9858939361572265 },
-    [animdata_JointKey_RightArm    ] = { -0.13497445992088364, 0.023718029655942097, 1.3732180299723549 },
-    [animdata_JointKey_RightForeArm] = { -0.2433288404551763, -0.06526073645152536, 1.132682970676682 },
-    [animdata_JointKey_RightHand   ] = { -0.25683982003972705, -0.29261729384838797, 0.9642230209051579 },
-    [animdata_JointKey_Neck        ] = { 0.02072107131665486, 0.03159289780614301, 1.447389880228084 },
-    [animdata_JointKey_Head        ] = { 0.021531082255674076, 0.005251667258749295, 1.5414100281392333 },
-    [animdata_JointKey_LeftArm     ] = { 0.1623373561931556, 0.05695001908586256, 1.3500015617994061 },
-    [animdata_JointKey_LeftForeArm ] = { 0.2058500640434151, 0.16830945737917405, 1.0985642072257786 },
-    [animdata_JointKey_LeftHand    ] = { 0.2213023871114901, 0.16409536287308463, 0.8157290164650953 },
-    [animdata_JointKey_RightLeg    ] = { -0.09242426691076226, 0.1056252109700564, 0.48582884751004557 },
-    [animdata_JointKey_RightToeBase] = { -0.03873263815579088, 0.3001762321274963, 0.004182927229561351 },
-    [animdata_JointKey_RightToe_End] = { -0.04257677874739476, 0.20756896205619782, 0.0000034869311443258556 },
-    [animdata_JointKey_LeftLeg     ] = { 0.0850163787088897, -0.27106959830052385, 0.5753201109911573 },
-    [animdata_JointKey_LeftToeBase ] = { 0.10564078299234357, -0.5404562751956593, 0.11958999472607772 },
-    [animdata_JointKey_LeftToe_End ] = { 0.11954382954918245, -0.6160278870260933, 0.1715901769839823 },
-  }},
-  { .time = 0.25, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.004681372046470642, -0.007627982497215271, 0.9675633239746094 },
-    [animdata_JointKey_RightArm    ] = { -0.12891557462320005, 0.014513504369580255, 1.3577328205124553 },
-    [animdata_JointKey_RightForeArm] = { -0.23841891199847104, -0.07460472043434332, 1.1177703820891691 },
-    [animdata_JointKey_RightHand   ] = { -0.2464826209839749, -0.31134625777172864, 0.9623975079739094 },
-    [animdata_JointKey_Neck        ] = { 0.02757213734934881, 0.025170122083749434, 1.4287975944730205 },
-    [animdata_JointKey_Head        ] = { 0.028374484887458657, 0.0017688157834336148, 1.5235923193245575 },
-    [animdata_JointKey_LeftArm     ] = { 0.16757091845204763, 0.052047852040821, 1.329066540013061 },
-    [animdata_JointKey_LeftForeArm ] = { 0.20487673899353964, 0.18023698116605594, 1.0847494060761091 },
-    [animdata_JointKey_LeftHand    ] = { 0.21747811156524488, 0.1668664042606364, 0.8020574811233169 },
-    [animdata_JointKey_RightLeg    ] = { -0.09230402233435657, 0.12199507280414562, 0.47265444195289547 },
-    [animdata_JointKey_RightToeBase] = { -0.03817484236798048, 0.383615324267021, 0.015190147612988536 },
-    [animdata_JointKey_RightToe_End] = { -0.043746294567775894, 0.29206224536351744, 0.0012135867761920438 },
-    [animdata_JointKey_LeftLeg     ] = { 0.08805229109574972, -0.28471560916062677, 0.560447684962783 },
-    [animdata_JointKey_LeftToeBase ] = { 0.09467647752807067, -0.5255683931058325, 0.09756755992174317 },
-    [animdata_JointKey_LeftToe_End ] = { 0.10178028213459123, -0.5961622298060628, 0.15735408099735618 },
-  }},
-  { .time = 0.2916666567325592, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.011213011741638183, -0.020052168369293213, 0.9566481018066406 },
-    [animdata_JointKey_RightArm    ] = { -0.12354550557642496, 0.005560938124930532, 1.3476402188666097 },
-    [animdata_JointKey_RightForeArm] = { -0.2337940279725347, -0.06860439154770342, 1.1029776109630656 },
-    [animdata_JointKey_RightHand   ] = { -0.23394599635328214, -0.31023190025717684, 0.9550977966007418 },
-    [animdata_JointKey_Neck        ] = { 0.033342722382838794, 0.016456897246919323, 1.4175054736234827 },
-    [animdata_JointKey_Head        ] = { 0.03533210117231671, -0.004665055169889287, 1.51281659710062 },
-    [animdata_JointKey_LeftArm     ] = { 0.17241205445876545, 0.03969253780670237, 1.3147541240884013 },
-    [animdata_JointKey_LeftForeArm ] = { 0.20642522716245926, 0.17372608720525026, 1.0731073950377594 },
-    [animdata_JointKey_LeftHand    ] = { 0.21753922788638505, 0.14727843368870627, 0.7912753780122498 },
-    [animdata_JointKey_RightLeg    ] = { -0.08871286734907288, 0.12534131884045926, 0.465331262850051 },
-    [animdata_JointKey_RightToeBase] = { -0.036490285019632716, 0.46378164403025834, 0.03630431074462836 },
-    [animdata_JointKey_RightToe_End] = { -0.044377992761637376, 0.3743251455233861, 0.012987555225624527 },
-    [animdata_JointKey_LeftLeg     ] = { 0.09262489195356963, -0.2865154459768346, 0.5411579025379931 },
-    [animdata_JointKey_LeftToeBase ] = { 0.08572969322373813, -0.47082035352556156, 0.04167959830036032 },
-    [animdata_JointKey_LeftToe_End ] = { 0.0905449737044025, -0.5539223658047313, 0.08265826591604065 },
-  }},
-  { .time = 0.3333333432674408, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.01833864450454712, -0.02894397258758545, 0.9560059356689453 },
-    [animdata_JointKey_RightArm    ] = { -0.11708121226059698, 0.0006965197332236917, 1.3442903858155555 },
-    [animdata_JointKey_RightForeArm] = { -0.22720488421678023, -0.04383995507147818, 1.092488319893332 },
-    [animdata_JointKey_RightHand   ] = { -0.22533958983927727, -0.28546975980107453, 0.9446239786279462 },
-    [animdata_JointKey_Neck        ] = { 0.03986411873994803, 0.011246254610117832, 1.416282156991914 },
-    [animdata_JointKey_Head        ] = { 0.04264340281122702, -0.009187691096648803, 1.5117234174420173 },
-    [animdata_JointKey_LeftArm     ] = { 0.1787183481711807, 0.03206157577970004, 1.313208262153832 },
-    [animdata_JointKey_LeftForeArm ] = { 0.21364737080601587, 0.1570997881506719, 1.0669148461574522 },
-    [animdata_JointKey_LeftHand    ] = { 0.22541872309393832, 0.11530314614838938, 0.7869741963656843 },
-    [animdata_JointKey_RightLeg    ] = { -0.08567581606499068, 0.10890410550193182, 0.4621582952919455 },
-    [animdata_JointKey_RightToeBase] = { -0.03573583465450193, 0.5218331614981425, 0.07453818674694565 },
-    [animdata_JointKey_RightToe_End] = { -0.04728744394488865, 0.44248956336226924, 0.02785300133337918 },
-    [animdata_JointKey_LeftLeg     ] = { 0.10008135911848628, -0.28268107995648345, 0.5324883657846197 },
-    [animdata_JointKey_LeftToeBase ] = { 0.08937243146428396, -0.3932501319984949, 0.000009230118611629478 },
-    [animdata_JointKey_LeftToe_End ] = { 0.09358836787212119, -0.4858137470667994, 0.004761611798020859 },
-  }},
-  { .time = 0.375, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.0247326135635376, -0.030628714561462402, 0.9636716461181641 },
-    [animdata_JointKey_RightArm    ] = { -0.11270143252781516, 0.0024718580756170104, 1.3515024249048748 },
-    [animdata_JointKey_RightForeArm] = { -0.21434229189768517, -0.010047494698286264, 1.0926058919504353 },
-    [animdata_JointKey_RightHand   ] = { -0.22131457632167528, -0.24037689647431268, 0.9278270628963041 },
-    [animdata_JointKey_Neck        ] = { 0.04414873438592782, 0.009108802855863733, 1.424056620183361 },
-    [animdata_JointKey_Head        ] = { 0.048277491793205146, -0.010316302015977418, 1.5196595668160404 },
-    [animdata_JointKey_LeftArm     ] = { 0.18237587817691453, 0.022551845219875345, 1.3172667445197441 },
-    [animdata_JointKey_LeftForeArm ] = { 0.22506336361291643, 0.14109090022284687, 1.0689900876225895 },
-    [animdata_JointKey_LeftHand    ] = { 0.23810448720304078, 0.0820580566289921, 0.7922278547181931 },
-    [animdata_JointKey_RightLeg    ] = { -0.08616246697300767, 0.06597792544295171, 0.4610737313200498 },
-    [animdata_JointKey_RightToeBase] = { -0.0421907675593983, 0.5190967552749164, 0.11096508819328803 },
-    [animdata_JointKey_RightToe_End] = { -0.05570416158746478, 0.47230901333284503, 0.031992638426846805 },
-    [animdata_JointKey_LeftLeg     ] = { 0.10492232343656341, -0.2665402305313361, 0.5286496451752457 },
-    [animdata_JointKey_LeftToeBase ] = { 0.08933275913995647, -0.31605573134186293, 0.000008639772168752558 },
-    [animdata_JointKey_LeftToe_End ] = { 0.09310024291298541, -0.40864833291817015, 0.004569138248828465 },
-  }},
-  { .time = 0.4166666567325592, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.030834648609161377, -0.028273181915283205, 0.9854425811767579 },
-    [animdata_JointKey_RightArm    ] = { -0.10713750488689446, 0.010665836516377538, 1.370826161902066 },
-    [animdata_JointKey_RightForeArm] = { -0.19439168400675078, 0.02306810798173065, 1.1067279121986575 },
-    [animdata_JointKey_RightHand   ] = { -0.2166271829803324, -0.17899379082012928, 0.9094239131249041 },
-    [animdata_JointKey_Neck        ] = { 0.04886595678311971, 0.010779326277059366, 1.4461153303186962 },
-    [animdata_JointKey_Head        ] = { 0.05387033140501751, -0.009788014109190765, 1.5414371299430993 },
-    [animdata_JointKey_LeftArm     ] = { 0.18786770512313763, 0.01827939600188125, 1.3392618812630257 },
-    [animdata_JointKey_LeftForeArm ] = { 0.23883620412676437, 0.11095914610147935, 1.0817202032274753 },
-    [animdata_JointKey_LeftHand    ] = { 0.25502044170421145, 0.05251716380551589, 0.8049985040698832 },
-    [animdata_JointKey_RightLeg    ] = { -0.08669647772785245, -0.00033964010418577664, 0.4769734507679465 },
-    [animdata_JointKey_RightToeBase] = { -0.05388980071159899, 0.4381395767114946, 0.1147930211369059 },
-    [animdata_JointKey_RightToe_End] = { -0.07110655383930965, 0.4043068264671405, 0.03013322661608262 },
-    [animdata_JointKey_LeftLeg     ] = { 0.1069679152106993, -0.2193833931298726, 0.5237034344672388 },
-    [animdata_JointKey_LeftToeBase ] = { 0.08946801836125964, -0.23926135204388732, 0.000009472583085887721 },
-    [animdata_JointKey_LeftToe_End ] = { 0.09340639237109823, -0.3317973440178654, 0.005483203170126604 },
-  }},
-  { .time = 0.4583333432674408, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.034328556060791014, -0.023165569305419922, 1.0074476623535156 },
-    [animdata_JointKey_RightArm    ] = { -0.10231158337188674, 0.020558376840985448, 1.387771712193867 },
-    [animdata_JointKey_RightForeArm] = { -0.1767724118747481, 0.05352785038762192, 1.1215319484147188 },
-    [animdata_JointKey_RightHand   ] = { -0.21238921606579225, -0.10699662113208781, 0.8908467793185352 },
-    [animdata_JointKey_Neck        ] = { 0.05191985418860529, 0.015597727178848013, 1.4682984254687204 },
-    [animdata_JointKey_Head        ] = { 0.056922170505035966, -0.006873390904373611, 1.5631895758700856 },
-    [animdata_JointKey_LeftArm     ] = { 0.19276137424301232, 0.020542388919736726, 1.3640612262764942 },
-    [animdata_JointKey_LeftForeArm ] = { 0.2509828536302493, 0.082379092251057, 1.0989169199149817 },
-    [animdata_JointKey_LeftHand    ] = { 0.269413656720861, 0.01811600789160992, 0.8236300911891141 },
-    [animdata_JointKey_RightLeg    ] = { -0.08360120654455681, -0.07654646782442726, 0.5053043070573648 },
-    [animdata_JointKey_RightToeBase] = { -0.06412479754641931, 0.29830733595786874, 0.09341858819318098 },
-    [animdata_JointKey_RightToe_End] = { -0.0826639339326805, 0.24608704713884058, 0.01900289804257434 },
-    [animdata_JointKey_LeftLeg     ] = { 0.11117038310083217, -0.15649599822511326, 0.5204450281643902 },
-    [animdata_JointKey_LeftToeBase ] = { 0.08932081394667855, -0.16211617997724836, 0.000009414970728478523 },
-    [animdata_JointKey_LeftToe_End ] = { 0.09326194300483225, -0.2546435313775038, 0.005625378029190736 },
-  }},
-  { .time = 0.5, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.03719133615493774, -0.018815325498580934, 1.0233467102050782 },
-    [animdata_JointKey_RightArm    ] = { -0.09892716587322543, 0.029087599073941633, 1.398972915941894 },
-    [animdata_JointKey_RightForeArm] = { -0.16239401970408093, 0.07191805252684043, 1.1312930230944798 },
-    [animdata_JointKey_RightHand   ] = { -0.2093404201282123, -0.03541806118276222, 0.8733641486709115 },
-    [animdata_JointKey_Neck        ] = { 0.05304168994642556, 0.01811654491699937, 1.4844694249426984 },
-    [animdata_JointKey_Head        ] = { 0.05749051956407269, -0.006557034258786032, 1.5788395853201247 },
-    [animdata_JointKey_LeftArm     ] = { 0.19591251436512608, 0.020743170400728088, 1.383458268365201 },
-    [animdata_JointKey_LeftForeArm ] = { 0.26469945557926977, 0.06022064069543419, 1.1165783133525384 },
-    [animdata_JointKey_LeftHand    ] = { 0.2791385821830465, -0.028276464367343285, 0.8478553048082421 },
-    [animdata_JointKey_RightLeg    ] = { -0.07510556868658746, -0.13895606643479705, 0.5368281584612994 },
-    [animdata_JointKey_RightToeBase] = { -0.07127107848902185, 0.1266482755477133, 0.06326602965910567 },
-    [animdata_JointKey_RightToe_End] = { -0.08786215269065585, 0.0512964341387331, 0.011737506556589467 },
-    [animdata_JointKey_LeftLeg     ] = { 0.11346520457470244, -0.0890145407793401, 0.5194144549934689 },
-    [animdata_JointKey_LeftToeBase ] = { 0.0894533875704795, -0.08377893443876051, 0.0007504267939138032 },
-    [animdata_JointKey_LeftToe_End ] = { 0.09332941285619649, -0.17621249125386107, 0.007778652979171454 },
-  }},
-  { .time = 0.5416666865348816, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.03878854990005493, -0.011780376434326173, 1.0286858367919922 },
-    [animdata_JointKey_RightArm    ] = { -0.09936151912421208, 0.03717600066939608, 1.4012944160268759 },
-    [animdata_JointKey_RightForeArm] = { -0.15705171943948976, 0.08691871497355305, 1.1335024951377026 },
-    [animdata_JointKey_RightHand   ] = { -0.2077907901090062, 0.03515386108307688, 0.8596444069997571 },
-    [animdata_JointKey_Neck        ] = { 0.05056883250322213, 0.02071284750984059, 1.4902871674329132 },
-    [animdata_JointKey_Head        ] = { 0.05400917286693645, -0.0053475871528642265, 1.5843261090761582 },
-    [animdata_JointKey_LeftArm     ] = { 0.19515398713499824, 0.02149835829927752, 1.392506611319074 },
-    [animdata_JointKey_LeftForeArm ] = { 0.28004641877630504, 0.04874328032228787, 1.1287528756118028 },
-    [animdata_JointKey_LeftHand    ] = { 0.28189833549283744, -0.07852881649847905, 0.8756705240626619 },
-    [animdata_JointKey_RightLeg    ] = { -0.06444344053147014, -0.18175209933571318, 0.559398378470084 },
-    [animdata_JointKey_RightToeBase] = { -0.07567749293765365, -0.057539324501642945, 0.040533833362087074 },
-    [animdata_JointKey_RightToe_End] = { -0.08891108672170264, -0.14722225206893133, 0.02078044451978508 },
-    [animdata_JointKey_LeftLeg     ] = { 0.11650308932766341, -0.0233897894799788, 0.5179283875057197 },
-    [animdata_JointKey_LeftToeBase ] = { 0.08880903404149973, -0.005928664981658009, 0.0002507841563265778 },
-    [animdata_JointKey_LeftToe_End ] = { 0.09270518834875474, -0.09837823986358975, 0.007053573490524619 },
-  }},
-  { .time = 0.5833333134651184, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.039372067451477054, -0.006770280599594117, 1.0226537322998046 },
-    [animdata_JointKey_RightArm    ] = { -0.1029894848048027, 0.03998992931276025, 1.3910216329368692 },
-    [animdata_JointKey_RightForeArm] = { -0.15877427721809023, 0.1140019534344785, 1.1284853519181988 },
-    [animdata_JointKey_RightHand   ] = { -0.20375366263215544, 0.09858626016070623, 0.8492157187384816 },
-    [animdata_JointKey_Neck        ] = { 0.04468378592898109, 0.021543869654203733, 1.4846621415590449 },
-    [animdata_JointKey_Head        ] = { 0.04737351390639419, -0.005612198028928717, 1.5784151047282762 },
-    [animdata_JointKey_LeftArm     ] = { 0.19100949922665528, 0.022889338503263353, 1.3903096695003465 },
-    [animdata_JointKey_LeftForeArm ] = { 0.2909464086812892, 0.0363094063373082, 1.1307956172821219 },
-    [animdata_JointKey_LeftHand    ] = { 0.2778765274046689, -0.1316271960697, 0.9030265253940677 },
-    [animdata_JointKey_RightLeg    ] = { -0.0551772740934152, -0.20449180009879275, 0.5645136510787561 },
-    [animdata_JointKey_RightToeBase] = { -0.07942602179770555, -0.23582830016420467, 0.03773287942366199 },
-    [animdata_JointKey_RightToe_End] = { -0.08771654395019023, -0.3269207473007253, 0.053282338613246 },
-    [animdata_JointKey_LeftLeg     ] = { 0.1176482506347273, 0.03679507047763276, 0.5125628269136239 },
-    [animdata_JointKey_LeftToeBase ] = { 0.08936545724476831, 0.07153684920334552, 0.0007222583333840405 },
-    [animdata_JointKey_LeftToe_End ] = { 0.09325857899470467, -0.020874714629060414, 0.008024887391858417 },
-  }},
-  { .time = 0.625, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.03994489669799805, -0.003993364572525025, 1.0083462524414062 },
-    [animdata_JointKey_RightArm    ] = { -0.10808646282749308, 0.04194673523869914, 1.3748303169757763 },
-    [animdata_JointKey_RightForeArm] = { -0.16314404572846672, 0.13233992941852665, 1.117317694814797 },
-    [animdata_JointKey_RightHand   ] = { -0.19659106072388727, 0.15273002037185474, 0.836750672528254 },
-    [animdata_JointKey_Neck        ] = { 0.03774837133054623, 0.02082887992850583, 1.4706351926869767 },
-    [animdata_JointKey_Head        ] = { 0.040457639930705884, -0.0070951706407961805, 1.5641617237999859 },
-    [animdata_JointKey_LeftArm     ] = { 0.18582499703290536, 0.022214554744886567, 1.37922092606519 },
-    [animdata_JointKey_LeftForeArm ] = { 0.29754944699238356, 0.018438127893484188, 1.1242338355904606 },
-    [animdata_JointKey_LeftHand    ] = { 0.2718881840140175, -0.1817906561544567, 0.925482177330139 },
-    [animdata_JointKey_RightLeg    ] = { -0.04824282075125651, -0.22306626246581196, 0.5604888542583106 },
-    [animdata_JointKey_RightToeBase] = { -0.07915427948519577, -0.3999227262367473, 0.07012486427705206 },
-    [animdata_JointKey_RightToe_End] = { -0.08319740029538533, -0.4796135664233313, 0.11746802860707163 },
-    [animdata_JointKey_LeftLeg     ] = { 0.1241367929486002, 0.07540697832033894, 0.5022639661489412 },
-    [animdata_JointKey_LeftToeBase ] = { 0.08928278010822974, 0.15048093686533132, 0.0005970355486639001 },
-    [animdata_JointKey_LeftToe_End ] = { 0.0932157051674385, 0.05804670199437471, 0.007584631026696961 },
-  }},
-  { .time = 0.6666666865348816, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.039705374240875245, -0.0009383654594421387, 0.9907440185546875 },
-    [animdata_JointKey_RightArm    ] = { -0.11195413911672603, 0.04466634083411938, 1.3550836186397988 },
-    [animdata_JointKey_RightForeArm] = { -0.16243660133036333, 0.15413247076901068, 1.1041180783193698 },
-    [animdata_JointKey_RightHand   ] = { -0.1870373520697054, 0.19813969250959165, 0.8253520875209492 },
-    [animdata_JointKey_Neck        ] = { 0.03209177137279847, 0.02132947743392995, 1.4531519118597236 },
-    [animdata_JointKey_Head        ] = { 0.034519971793848504, -0.006996929631307607, 1.5465650976008312 },
-    [animdata_JointKey_LeftArm     ] = { 0.18155033388051972, 0.022532259305310057, 1.364022619845745 },
-    [animdata_JointKey_LeftForeArm ] = { 0.30109751980611293, -0.0002245623270914532, 1.1136116953265305 },
-    [animdata_JointKey_LeftHand    ] = { 0.26812676893433207, -0.22291445575594654, 0.9416395270797847 },
-    [animdata_JointKey_RightLeg    ] = { -0.04409892979108872, -0.2369323631395835, 0.5523564941574192 },
-    [animdata_JointKey_RightToeBase] = { -0.06907469499598104, -0.5183492238883536, 0.12083130736719486 },
-    [animdata_JointKey_RightToe_End] = { -0.0732781776260774, -0.5798541326010865, 0.1901698211982049 },
-    [animdata_JointKey_LeftLeg     ] = { 0.13365035005624668, 0.09387756309579633, 0.48733478647192124 },
-    [animdata_JointKey_LeftToeBase ] = { 0.089251611117197, 0.23350528610419935, 0.0003334636196341201 },
-    [animdata_JointKey_LeftToe_End ] = { 0.09324729220214599, 0.14100266142225626, 0.00630680004004901 },
-  }},
-  { .time = 0.7083333134651184, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.03817349910736084, 0.0006329214572906494, 0.9711629486083985 },
-    [animdata_JointKey_RightArm    ] = { -0.11651980176535094, 0.04736165010490307, 1.3340417638311015 },
-    [animdata_JointKey_RightForeArm] = { -0.16077676938923058, 0.17877513885057042, 1.0926150864926383 },
-    [animdata_JointKey_RightHand   ] = { -0.17645060865480425, 0.2304492975508482, 0.8145208018064954 },
-    [animdata_JointKey_Neck        ] = { 0.02571415107550393, 0.0207901136929281, 1.433581314008285 },
-    [animdata_JointKey_Head        ] = { 0.028201383183631287, -0.005770725772263945, 1.5275102244979275 },
-    [animdata_JointKey_LeftArm     ] = { 0.17620386341020122, 0.020204357372611153, 1.3457662410456828 },
-    [animdata_JointKey_LeftForeArm ] = { 0.3015905793485079, -0.017669763224333918, 1.100086038933296 },
-    [animdata_JointKey_LeftHand    ] = { 0.2662126121325195, -0.25319459087199575, 0.94669522330436 },
-    [animdata_JointKey_RightLeg    ] = { -0.039772172935106646, -0.25927705059676426, 0.5485622303421824 },
-    [animdata_JointKey_RightToeBase] = { -0.0521434599258555, -0.5598063100770678, 0.13680038117870197 },
-    [animdata_JointKey_RightToe_End] = { -0.054456583746767734, -0.6160109290826125, 0.21058413483317737 },
-    [animdata_JointKey_LeftLeg     ] = { 0.13505974445193125, 0.11130501554567503, 0.47056545192073096 },
-    [animdata_JointKey_LeftToeBase ] = { 0.08935093461310473, 0.31867709378704656, 0.0022170510283921097 },
-    [animdata_JointKey_LeftToe_End ] = { 0.09353569348446743, 0.22614354302283604, 0.007547277160517958 },
-  }},
-  { .time = 0.75, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.03290032386779785, -0.004969438314437866, 0.9547395324707031 },
-    [animdata_JointKey_RightArm    ] = { -0.12205109056407462, 0.043588388388017985, 1.316153822910026 },
-    [animdata_JointKey_RightForeArm] = { -0.16070595508437535, 0.19017029310471345, 1.0826274484419054 },
-    [animdata_JointKey_RightHand   ] = { -0.17189376130136438, 0.2442910844678438, 0.8047820088788705 },
-    [animdata_JointKey_Neck        ] = { 0.018997635880147978, 0.016105225102856387, 1.4170180005374866 },
-    [animdata_JointKey_Head        ] = { 0.021267639741667076, -0.007330419074627881, 1.511780453164527 },
-    [animdata_JointKey_LeftArm     ] = { 0.17003175816069846, 0.013259360996930415, 1.3300419370361496 },
-    [animdata_JointKey_LeftForeArm ] = { 0.3000298817516121, -0.03233122898125656, 1.088097651138605 },
-    [animdata_JointKey_LeftHand    ] = { 0.26643611999802064, -0.2740895720516531, 0.9443038536749413 },
-    [animdata_JointKey_RightLeg    ] = { -0.03613651793560712, -0.2826540662902878, 0.5458858412936781 },
-    [animdata_JointKey_RightToeBase] = { -0.03961450355884915, -0.5352233672585734, 0.09728846817614256 },
-    [animdata_JointKey_RightToe_End] = { -0.03760906551192599, -0.5945054913817384, 0.1686324286346708 },
-    [animdata_JointKey_LeftLeg     ] = { 0.12690336149007522, 0.14419634943227233, 0.46247888008100996 },
-    [animdata_JointKey_LeftToeBase ] = { 0.08943673339359855, 0.3989636461007226, 0.008516217168849441 },
-    [animdata_JointKey_LeftToe_End ] = { 0.09336968578139515, 0.3063161626127117, 0.0054571752398553785 },
-  }},
-  { .time = 0.7916666865348816, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.025765085220336915, -0.011922593116760255, 0.9487765502929688 },
-    [animdata_JointKey_RightArm    ] = { -0.12534161637043764, 0.03916058473395295, 1.3090620771793067 },
-    [animdata_JointKey_RightForeArm] = { -0.1596364341511837, 0.18872289225034994, 1.0767476522552442 },
-    [animdata_JointKey_RightHand   ] = { -0.17216364888838406, 0.24255441088952506, 0.7989031944242198 },
-    [animdata_JointKey_Neck        ] = { 0.015441214028507124, 0.013477844713793605, 1.4107220071559032 },
-    [animdata_JointKey_Head        ] = { 0.017195977813595487, -0.007768943816356637, 1.5060099892768046 },
-    [animdata_JointKey_LeftArm     ] = { 0.16593134836228188, 0.008287092912066753, 1.3221029322171969 },
-    [animdata_JointKey_LeftForeArm ] = { 0.2995295192316867, -0.03709117325918435, 1.082087558778981 },
-    [animdata_JointKey_LeftHand    ] = { 0.27018983033478056, -0.27872316472174324, 0.9371549719729149 },
-    [animdata_JointKey_RightLeg    ] = { -0.04047231739130267, -0.28492293077673114, 0.5380787879967599 },
-    [animdata_JointKey_RightToeBase] = { -0.03781339895211418, -0.4766046089910371, 0.03962394787432652 },
-    [animdata_JointKey_RightToe_End] = { -0.03509398008188312, -0.5561541277556195, 0.08729816619247135 },
-    [animdata_JointKey_LeftLeg     ] = { 0.12538379713973627, 0.1368416762787357, 0.45518634541354347 },
-    [animdata_JointKey_LeftToeBase ] = { 0.09349305682737194, 0.4619470922061142, 0.03632708513309682 },
-    [animdata_JointKey_LeftToe_End ] = { 0.09811995272412759, 0.37545188616955777, 0.003077227467347852 },
-  }},
-  { .time = 0.8333333134651184, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.018715879917144775, -0.01502315640449524, 0.9549089050292969 },
-    [animdata_JointKey_RightArm    ] = { -0.12737272809761424, 0.03469430383283935, 1.3138529309445355 },
-    [animdata_JointKey_RightForeArm] = { -0.16546254712613173, 0.18254437832894443, 1.081034263895802 },
-    [animdata_JointKey_RightHand   ] = { -0.17869995426318988, 0.2244733211294059, 0.8011788713889848 },
-    [animdata_JointKey_Neck        ] = { 0.013473705994831576, 0.012874039445685269, 1.4165425274879442 },
-    [animdata_JointKey_Head        ] = { 0.014704089100606091, -0.006143790484523177, 1.512308455893829 },
-    [animdata_JointKey_LeftArm     ] = { 0.1645439862402588, 0.009466873042229955, 1.3291185080346475 },
-    [animdata_JointKey_LeftForeArm ] = { 0.2961523697159111, -0.04023968458172325, 1.0888613376334237 },
-    [animdata_JointKey_LeftHand    ] = { 0.2750355235314204, -0.2716030671532223, 0.9267584564386389 },
-    [animdata_JointKey_RightLeg    ] = { -0.05003692281197798, -0.2695581867102667, 0.5332244238317876 },
-    [animdata_JointKey_RightToeBase] = { -0.040007902542996396, -0.4051970669862901, 0.004457988193407765 },
-    [animdata_JointKey_RightToe_End] = { -0.03626883250835086, -0.4976432767754077, 0.011391221163061077 },
-    [animdata_JointKey_LeftLeg     ] = { 0.13324683733787537, 0.07920138462938484, 0.4491664969251908 },
-    [animdata_JointKey_LeftToeBase ] = { 0.09242107936462605, 0.4956258358805792, 0.09556601099444333 },
-    [animdata_JointKey_LeftToe_End ] = { 0.10063472957317021, 0.43630894017605915, 0.024696950706478846 },
-  }},
-  { .time = 0.875, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.010546388626098633, -0.015532617568969728, 0.9702629852294922 },
-    [animdata_JointKey_RightArm    ] = { -0.13192276725053756, 0.029501856797858706, 1.3288776938100213 },
-    [animdata_JointKey_RightForeArm] = { -0.17775002520667182, 0.16605064563771357, 1.0906146011876907 },
-    [animdata_JointKey_RightHand   ] = { -0.19302846696781828, 0.1899408999229538, 0.8087491529965233 },
-    [animdata_JointKey_Neck        ] = { 0.009806185780756878, 0.013085149964794672, 1.4318782402777552 },
-    [animdata_JointKey_Head        ] = { 0.009946503743851772, -0.0040497632099514005, 1.528006695024126 },
-    [animdata_JointKey_LeftArm     ] = { 0.16068015917843467, 0.013499109640563762, 1.3441300837703285 },
-    [animdata_JointKey_LeftForeArm ] = { 0.2881622087730749, -0.040949185601834054, 1.1026787425329967 },
-    [animdata_JointKey_LeftHand    ] = { 0.2761686525806744, -0.25307559075943586, 0.9152999008551275 },
-    [animdata_JointKey_RightLeg    ] = { -0.055703507456397586, -0.24532978942508368, 0.5335956731519506 },
-    [animdata_JointKey_RightToeBase] = { -0.04089092610830312, -0.3304502896986462, 0.0006923020337620045 },
-    [animdata_JointKey_RightToe_End] = { -0.037082895988072226, -0.42275401230578047, 0.009287261458458013 },
-    [animdata_JointKey_LeftLeg     ] = { 0.13656559035903545, 0.019208763055353236, 0.45962820187692166 },
-    [animdata_JointKey_LeftToeBase ] = { 0.09561184583707967, 0.48139208909455833, 0.14569592039257617 },
-    [animdata_JointKey_LeftToe_End ] = { 0.10738847114070028, 0.450279564908047, 0.059083547177521116 },
-  }},
-  { .time = 0.9166666865348816, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.005909340381622314, -0.015576298236846925, 0.9888990783691406 },
-    [animdata_JointKey_RightArm    ] = { -0.13564737021577536, 0.027837894615836828, 1.3482806853626812 },
-    [animdata_JointKey_RightForeArm] = { -0.19110266689739314, 0.14306780608949105, 1.1009715714436834 },
-    [animdata_JointKey_RightHand   ] = { -0.20889122762925916, 0.14277627012715033, 0.8182423781507763 },
-    [animdata_JointKey_Neck        ] = { 0.007239973135778954, 0.01596585553815347, 1.4504571279568796 },
-    [animdata_JointKey_Head        ] = { 0.007020591335073503, -0.0012653392357184657, 1.5465682228028785 },
-    [animdata_JointKey_LeftArm     ] = { 0.1575020292029499, 0.020052416936078583, 1.3618093711951158 },
-    [animdata_JointKey_LeftForeArm ] = { 0.2759515077518521, -0.036695978934298205, 1.116321330943635 },
-    [animdata_JointKey_LeftHand    ] = { 0.2763851540251722, -0.2212813574833747, 0.9014252172923921 },
-    [animdata_JointKey_RightLeg    ] = { -0.06087441629539198, -0.20421060507764155, 0.5290956092622634 },
-    [animdata_JointKey_RightToeBase] = { -0.04021618296505932, -0.2535570577481078, 0.0005761911116695729 },
-    [animdata_JointKey_RightToe_End] = { -0.03642500188657341, -0.34590691781410043, 0.008668300322034096 },
-    [animdata_JointKey_LeftLeg     ] = { 0.13718017137417735, -0.047588705206764344, 0.4820226260689738 },
-    [animdata_JointKey_LeftToeBase ] = { 0.1004124273661449, 0.3973091431757873, 0.15081952452561437 },
-    [animdata_JointKey_LeftToe_End ] = { 0.11370247379882197, 0.36391339727525457, 0.06528310316105589 },
-  }},
-  { .time = 0.9583333134651184, .joint_pos = {
-    [animdata_JointKey_Hips        ] = { 0.0028179246187210083, -0.01590230703353882, 1.004370346069336 },
-    [animdata_JointKey_RightArm    ] = { -0.139514007051203, 0.026147491458581872, 1.3670836045764723 },
-    [animdata_JointKey_RightForeArm] = { -0.2083560585980075, 0.11391194847012981, 1.1119891746556168 },
-    [animdata_JointKey_RightHand   ] = { -0.22669275831958208, 0.0850621414368513, 0.8307708444720366 },
-    [animdata_JointKey_Neck        ] = { 0.005618103603116426, 0.018537557724028448, 1.4658605614052487 },
-    [animdata_JointKey_Head        ] = { 0.006456068050618182, 0.00026946028337465177, 1.5617765619799877 },
-    [animdata_JointKey_LeftArm     ] = { 0.15434265605139103, 0.026212560347625702, 1.3743720365283871 },
-    [animdata_JointKey_LeftForeArm ] = { 0.2659453113303989, -0.017044517795312363, 1.122998428792901 },
-    [animdata_JointKey_LeftHand    ] = { 0.2746541218957829, -0.17704531888506275, 0.8893829787620814 },
-    [animdata_JointKey_RightLeg    ] = { -0.06698517740800888, -0.15596587477813176, 0.5237158470663895 },
-    [animdata_JointKey_RightToeBase] = { -0.04029568287983472, -0.17617805227150748, 0.00021240000907775782 },
-    [animdata_JointKey_RightToe_End] = { -0.03655413396274789, -0.2685639803678464, 0.007906106145527114 },
-    [animdata_JointKey_LeftLeg     ] = { 0.131960163243798, -0.11400215873907323, 0.5104349559447519 },
-    [animdata_JointKey_LeftToeBase ] = { 0.10110773896537349, 0.25980297784179235, 0.11720335657344054 },
-    [animdata_JointKey_LeftToe_End ] = { 0.11415300386739478, 0.2033487051317435, 0.04473875891338885 },
-  }},
+/* cooked by anim_cooker from joints/walk.txt: 24 of 24 keys kept at 0.001m tolerance */
+
+float animdata_walk_key_times[] = {
+  0, 0.0416666679, 0.0833333358, 0.125, 0.166666672, 0.208333328, 0.25, 0.291666657,
+  0.333333343, 0.375, 0.416666657, 0.458333343, 0.5, 0.541666687, 0.583333313, 0.625,
+  0.666666687, 0.708333313, 0.75, 0.791666687, 0.833333313, 0.875, 0.916666687, 0.958333313,
+};
+
+uint16_t animdata_walk_keys[] = {
+  /* joint  0 x */ 30622, 30405, 30293, 30240, 30299, 30548, 31125, 31882, 32707, 33448, 34156, 34561, 34892, 35077, 35145, 35212, 35184, 35006, 34395, 33568, 32751, 31804, 31267, 30909,
+  /* joint  0 y */ 34599, 34771, 34917, 35124, 35394, 35521, 35041, 34325, 33813, 33716, 33852, 34146, 34396, 34802, 35090, 35250, 35426, 35517, 35194, 34793, 34615, 34585, 34583, 34564,
+  /* joint  0 z */ 42033, 42312, 42229, 41880, 41376, 40781, 40023, 39571, 39545, 39862, 40762, 41673, 42330, 42551, 42302, 41710, 40982, 40172, 39492, 39246, 39499, 40134, 40905, 41545,
+  /* joint  1 x */ 14085, 14182, 14333, 14396, 14531, 14939, 15641, 16264, 17013, 17521, 18165, 18725, 19117, 19067, 18646, 18055, 17607, 17078, 16437, 16056, 15820, 15293, 14861, 14413,
+  /* joint  1 y */ 36832, 36804, 36796, 36854, 36915, 36846, 36316, 35800, 35520, 35622, 36094, 36664, 37155, 37621, 37783, 37896, 38053, 38208, 37991, 37736, 37478, 37179, 37083, 36986,
+  /* joint  1 z */ 57259, 57738, 57823, 57592, 57221, 56803, 56162, 55745, 55606, 55904, 56704, 57405, 57868, 57964, 57539, 56869, 56052, 55182, 54442, 54149, 54347, 54968, 55771, 56549,
+  /* joint  2 x */  4137,  3114,  1837,  1155,  1413,  2381,  2950,  3486,  4250,  5741,  8053, 10095, 11761, 12381, 12181, 11674, 11756, 11949, 11957, 12081, 11406,  9982,  8434,  6435,
+  /* joint  2 y */ 39951, 39203, 37343, 35177, 33181, 31721, 31183, 31529, 32955, 34901, 36809, 38563, 39622, 40486, 42046, 43102, 44357, 45777, 46433, 46350, 45994, 45044, 43720, 42041,
+  /* joint  2 z */ 46535, 47058, 47212, 47159, 47047, 46853, 46236, 45624, 45190, 45195, 45779, 46392, 46795, 46887, 46679, 46217, 45671, 45196, 44782, 44539, 44716, 45113, 45541, 45997,
+  /* joint  3 x */  2045,  1101,   405,     0,   152,   816,  2016,  3469,  4466,  4933,  5476,  5967,  6321,  6500,  6968,  7798,  8905, 10132, 10660, 10629,  9872,  8211,  6373,  4309,
+  /* joint  3 y */ 36707, 32032, 27551, 23623, 20586, 18627, 17548, 17612, 19038, 21636, 25171, 29318, 33440, 37505, 41158, 44277, 46892, 48753, 49550, 49450, 48409, 46420, 43703, 40379,
+  /* joint  3 z */ 35075, 36557, 37853, 38896, 39611, 39885, 39809, 39507, 39074, 38379, 37618, 36849, 36126, 35559, 35127, 34612, 34140, 33692, 33289, 33046, 33140, 33454, 33846, 34364,
+  /* joint  4 x */ 31240, 31621, 31970, 32159, 32424, 32984, 33778, 34446, 35202, 35699, 36245, 36599, 36729, 36443, 35761, 34957, 34301, 33562, 32784, 32372, 32144, 31719, 31421, 31233,
+  /* joint  4 y */ 36644, 36760, 36868, 37026, 37226, 37300, 36930, 36428, 36128, 36005, 36101, 36378, 36523, 36673, 36721, 36680, 36709, 36677, 36408, 36256, 36222, 36234, 36400, 36548,
+  /* joint  4 z */ 61122, 61403, 61319, 60971, 60469, 59871, 59102, 58635, 58584, 58906, 59818, 60736, 61404, 61645, 61412, 60832, 60109, 59299, 58614, 58354, 58595, 59229, 59998, 60635,
+  /* joint  5 x */ 31674, 32068, 32366, 32485, 32632, 33077, 33871, 34677, 35524, 36177, 36825, 37179, 37245, 36841, 36072, 35271, 34583, 33850, 33047, 32575, 32286, 31735, 31396, 31330,
+  /* joint  5 y */ 35492, 35530, 35534, 35582, 35693, 35783, 35582, 35211, 34951, 34886, 34916, 35084, 35102, 35172, 35157, 35071, 35077, 35148, 35058, 35033, 35126, 35247, 35407, 35496,
+  /* joint  5 z */ 65072, 65341, 65240, 64873, 64354, 63760, 63023, 62577, 62532, 62860, 63761, 64661, 65308, 65535, 65290, 64701, 63973, 63185, 62534, 62295, 62556, 63205, 63973, 64602,
+  /* joint  6 x */ 48304, 48511, 48703, 48818, 48988, 49396, 50003, 50564, 51295, 51719, 52355, 52922, 53287, 53200, 52719, 52118, 51623, 51003, 50288, 49813, 49652, 49204, 48836, 48470,
+  /* joint  6 y */ 37345, 37687, 38010, 38289, 38570, 38760, 38478, 37766, 37327, 36779, 36533, 36663, 36675, 36718, 36798, 36760, 36778, 36644, 36244, 35957, 36025, 36258, 36635, 36990,
+  /* joint  6 z */ 57263, 57499, 57363, 57014, 56491, 55842, 54976, 54384, 54320, 54488, 55398, 56424, 57226, 57600, 57510, 57051, 56422, 55667, 55017, 54688, 54978, 55599, 56331, 56850,
+  /* joint  7 x */ 60104, 58875, 57975, 56726, 55347, 54439, 54326, 54506, 55343, 56666, 58262, 59670, 61259, 63038, 64301, 65067, 65478, 65535, 65354, 65296, 64905, 63979, 62564, 61404,
+  /* joint  7 y */ 36735, 39036, 41139, 42820, 44152, 45174, 45861, 45486, 44528, 43606, 41871, 40225, 38948, 38287, 37571, 36542, 35467, 34462, 33618, 33344, 33162, 33122, 33367, 34498,
+  /* joint  7 z */ 46553, 46635, 46563, 46333, 45936, 45442, 44870, 44389, 44132, 44218, 44745, 45456, 46187, 46690, 46775, 46503, 46064, 45505, 45009, 44760, 45040, 45612, 46176, 46452,
+  /* joint  8 x */ 62030, 61665, 60496, 58879, 57284, 56230, 55787, 55794, 56707, 58177, 60138, 61806, 62933, 63253, 62787, 62093, 61657, 61435, 61461, 61896, 62457, 62589, 62614, 62413,
+  /* joint  8 y */ 28620, 32647, 36528, 40081, 43036, 44931, 45091, 43963, 42121, 40206, 38505, 36523, 33851, 30957, 27899, 25010, 22641, 20897, 19694, 19427, 19837, 20904, 22735, 25283,
+  /* joint  8 z */ 36411, 35899, 35359, 34807, 34266, 33742, 33177, 32731, 32553, 32770, 33298, 34069, 35071, 36222, 37353, 38282, 38950, 39160, 39061, 38765, 38335, 37861, 37287, 36789,
+  /* joint  9 x */ 22199, 21829, 21226, 20644, 20106, 19871, 19884, 20301, 20653, 20596, 20534, 20893, 21878, 23113, 24187, 24991, 25471, 25973, 26394, 25892, 24783, 24126, 23527, 22819,
+  /* joint  9 y */ 29823, 32707, 35327, 37801, 39840, 41564, 42506, 42699, 41752, 39280, 35461, 31071, 27477, 25012, 23702, 22633, 21834, 20547, 19201, 19070, 19955, 21350, 23719, 26497,
+  /* joint  9 z */ 21474, 21443, 21246, 20918, 20519, 20096, 19551, 19248, 19117, 19072, 19730, 20902, 22206, 23139, 23351, 23184, 22848, 22691, 22580, 22257, 22057, 22072, 21886, 21663,
+  /* joint 10 x */ 25924, 25948, 25968, 25980, 26043, 26093, 26158, 26353, 26440, 25692, 24337, 23150, 22322, 21811, 21377, 21408, 22577, 24539, 25991, 26200, 25945, 25843, 25921, 25912,
+  /* joint 10 y */ 29754, 34292, 38807, 43360, 48019, 52769, 57574, 62192, 65535, 65377, 60715, 52661, 42774, 32166, 21898, 12447,  5626,  3238,  4654,  8030, 12143, 16448, 20876, 25333,
+  /* joint 10 z */     6,    21,    19,    14,    39,   173,   628,  1502,  3083,  4590,  4748,  3864,  2617,  1677,  1561,  2901,  4998,  5659,  4024,  1639,   184,    28,    24,     9,
+  /* joint 11 x */ 26357, 26143, 25973, 25836, 25774, 25648, 25512, 25439, 25102, 24126, 22341, 21002, 20399, 20278, 20416, 20940, 22089, 24271, 26223, 26515, 26379, 26284, 26361, 26346,
+  /* joint 11 y */ 24434, 28952, 33463, 38017, 42677, 47435, 52301, 57039, 60965, 62683, 58766, 49653, 38434, 27001, 16651,  7857,  2083,     1,  1240,  3448,  6818, 11132, 15558, 20012,
+  /* joint 11 z */   333,   154,     0,     0,     0,     0,    50,   537,  1152,  1323,  1246,   786,   485,   859,  2204,  4859,  7866,  8711,  6975,  3611,   471,   384,   358,   327,
+  /* joint 12 x */ 45445, 44175, 42937, 41959, 40965, 40435, 40787, 41317, 42181, 42742, 42979, 43466, 43732, 44084, 44217, 44969, 46072, 46235, 45290, 45113, 46025, 46409, 46481, 45876,
+  /* joint 12 y */ 25289, 23463, 22380, 21778, 21081, 19868, 19082, 18978, 19199, 20129, 22845, 26467, 30353, 34133, 37599, 39823, 40887, 41891, 43785, 43361, 40042, 36586, 32739, 28914,
+  /* joint 12 z */ 22522, 23428, 23763, 23732, 23682, 23798, 23183, 22385, 22026, 21867, 21663, 21528, 21485, 21424, 21202, 20776, 20158, 19465, 19130, 18828, 18579, 19012, 19939, 21114,
+  /* joint 13 x */ 41904, 42847, 43834, 44246, 43837, 42825, 41555, 40518, 40940, 40935, 40951, 40934, 40949, 40875, 40939, 40930, 40926, 40937, 40947, 41417, 41293, 41663, 42219, 42300,
+  /* joint 13 y */ 40915, 31687, 22211, 13767,  7289,  4353,  5210,  8363, 12831, 17277, 21700, 26143, 30655, 35139, 39600, 44147, 48929, 53834, 58458, 62086, 64026, 63206, 58363, 50443,
+  /* joint 13 z */  3467,  2287,  1925,  2515,  3906,  4947,  4036,  1724,     0,     0,     0,     0,    31,    10,    30,    25,    14,    92,   352,  1503,  3953,  6027,  6238,  4848,
+  /* joint 14 x */ 43358, 45304, 46440, 46141, 45767, 44437, 42378, 41076, 41429, 41372, 41407, 41391, 41399, 41326, 41390, 41385, 41389, 41422, 41403, 41954, 42245, 43028, 43760, 43812,
+  /* joint 14 y */ 36583, 26679, 17030,  8684,  2567,     0,  1144,  3577,  7500, 11944, 16370, 20814, 25331, 29814, 34278, 38823, 43601, 48505, 53122, 57104, 60609, 61414, 56440, 47192,
+  /* joint 14 z */  1281,  1276,  2064,  3487,  5565,  7098,  6509,  3419,   197,   189,   227,   233,   322,   292,   332,   314,   261,   312,   226,   127,  1021,  2444,  2700,  1850,
+};
+
+animdata_Clip animdata_walk_clip = {
+  .duration  = 1,
+  .key_count = 24,
+  .key_times = animdata_walk_key_times,
+  .min       = { -0.263876885, -0.616027892, 3.48302387e-06 },
+  .extent    = { 0.565467477, 1.13786101, 1.58432269 },
+  .keys      = animdata_walk_keys,
 };
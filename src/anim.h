@@ -36,11 +36,6 @@ struct { animdata_JointKey from, to; } animdata_limb_connections[] = {
   { .from = animdata_JointKey_LeftToeBase,  .to = animdata_JointKey_LeftToe_End  },
 };
 
-typedef struct {
-    float time;
-    f3 joint_pos[animdata_JointKey_COUNT];
-} animdata_Frame;
-
 f3 animdata_base_pose[animdata_JointKey_COUNT] = {
   [animdata_JointKey_Hips        ] = { -0.00031874649226665497, -0.015492378473281861, 1.0216461944580078 },
   [animdata_JointKey_RightArm    ] = { -0.15209491310914705, 0.019500644285726502, 1.418633234974889 },
@@ -59,32 +54,117 @@ f3 animdata_base_pose[animdata_JointKey_COUNT] = {
   [animdata_JointKey_LeftToe_End ] = { 0.23055954096239675, -0.22386654206013057, 0.0090544371624689 },
 };
 
-static f3 animdata_sample(
-  animdata_Frame    *animdata_frames,
-  size_t             animdata_frame_count,
-  float              animdata_duration,
-  animdata_JointKey  joint,
-  float              anim_t
-) {
-  size_t rhs_frame = -1;
-  for (size_t i = 0; i < animdata_frame_count; i++)
-    if (animdata_frames[i].time > anim_t) { rhs_frame = i; break; }
-  bool last_frame = rhs_frame == -1;
-
-  size_t lhs_frame = (last_frame ? animdata_frame_count : rhs_frame) - 1;
-  rhs_frame = (lhs_frame + 1) % animdata_frame_count;
-  float next_frame_t = last_frame ? animdata_duration : animdata_frames[rhs_frame].time;
-  float this_frame_t = animdata_frames[lhs_frame].time;
-  float tween_t = (anim_t - this_frame_t) / (next_frame_t - this_frame_t);
-
-  return f3_lerp(
-    animdata_frames[lhs_frame].joint_pos[joint],
-    animdata_frames[rhs_frame].joint_pos[joint],
-    tween_t
-  );
+/* A clip stored channel by channel: every joint's x, y and z over time is one contiguous
+ * run of 16-bit values, quantized between the clip's min and min + extent. Every channel
+ * shares the same key times. (animations/anim_cooker.c makes these) */
+typedef struct {
+  float     duration;
+  size_t    key_count;
+  float    *key_times;
+  f3        min, extent;
+  /* [joint*3 + axis][key] */
+  uint16_t *keys;
+} animdata_Clip;
+
+#define animdata_QUANT_MAX 65535.0f
+
+/* the two keys either side of a point in time, and how far between them it is */
+typedef struct {
+  size_t lhs, rhs;
+  float  t;
+} animdata_Key;
+
+/* Finds the keys either side of anim_t. Pass in a cursor (initialized to 0)
+ * that lives as long as the playback does, and as long as anim_t only goes
+ * forward, this is a step or two instead of a search. Otherwise, it bisects. */
+static animdata_Key animdata_locate(animdata_Clip *clip, float anim_t, size_t *cursor) {
+  float *times = clip->key_times;
+  size_t count = clip->key_count;
+
+  /* lhs is the last key at or before anim_t */
+  size_t lhs = (cursor && *cursor < count) ? *cursor : 0;
+  if (times[lhs] <= anim_t) {
+    /* still going forwards, just walk */
+    while (lhs + 1 < count && times[lhs + 1] <= anim_t) lhs++;
+  } else {
+    /* looped (or went backwards), search */
+    size_t lo = 0, hi = count;
+    while (hi - lo > 1) {
+      size_t mid = lo + (hi - lo)/2;
+      if (times[mid] <= anim_t) lo = mid;
+      else                      hi = mid;
+    }
+    lhs = lo;
+  }
+  if (cursor) *cursor = lhs;
+
+  /* the last key tweens back into the first one */
+  bool last_key = lhs + 1 == count;
+  size_t rhs = last_key ? 0 : lhs + 1;
+  float next_key_t = last_key ? clip->duration : times[rhs];
+  float this_key_t = times[lhs];
+
+  return (animdata_Key) {
+    .lhs = lhs,
+    .rhs = rhs,
+    .t = (anim_t - this_key_t) / (next_key_t - this_key_t),
+  };
+}
+
+/* out = lerp(a, b, t) for every joint; poses are flat float arrays so this vectorizes */
+static void animdata_pose_lerp(f3 *out, f3 *a, f3 *b, float t) {
+  float *o = &out->x, *fa = &a->x, *fb = &b->x;
+  for (int i = 0; i < animdata_JointKey_COUNT*3; i++)
+    o[i] = fa[i] + (fb[i] - fa[i])*t;
+}
+
+/* decodes every joint at key into pose */
+static void animdata_sample_pose(animdata_Clip *clip, animdata_Key key, f3 pose[animdata_JointKey_COUNT]) {
+  float *out = &pose->x;
+  float min[3]   = { clip->min.x, clip->min.y, clip->min.z };
+  float scale[3] = {
+    clip->extent.x / animdata_QUANT_MAX,
+    clip->extent.y / animdata_QUANT_MAX,
+    clip->extent.z / animdata_QUANT_MAX,
+  };
+
+  /* lerp in the quantized space, then dequantize */
+  for (int i = 0; i < animdata_JointKey_COUNT*3; i++) {
+    uint16_t *channel = clip->keys + i*clip->key_count;
+    float a = channel[key.lhs];
+    float b = channel[key.rhs];
+    out[i] = min[i % 3] + (a + (b - a)*key.t)*scale[i % 3];
+  }
+}
+
+/* decodes just the one joint at key */
+static f3 animdata_sample_joint(animdata_Clip *clip, animdata_Key key, animdata_JointKey joint) {
+  float min[3]    = { clip->min.x,    clip->min.y,    clip->min.z    };
+  float extent[3] = { clip->extent.x, clip->extent.y, clip->extent.z };
+
+  float out[3];
+  for (int axis = 0; axis < 3; axis++) {
+    uint16_t *channel = clip->keys + (joint*3 + axis)*clip->key_count;
+    float a = channel[key.lhs];
+    float b = channel[key.rhs];
+    out[axis] = min[axis] + (a + (b - a)*key.t)*(extent[axis] / animdata_QUANT_MAX);
+  }
+  return (f3) { out[0], out[1], out[2] };
 }
 
 #include "../animations/include/walk.h"
 #include "../animations/include/turn90_right.h"
 #include "../animations/include/turn90_left.h"
 
+typedef enum {
+  animdata_ClipKey_Walk,
+  animdata_ClipKey_Turn90Left,
+  animdata_ClipKey_Turn90Right,
+  animdata_ClipKey_COUNT
+} animdata_ClipKey;
+
+static animdata_Clip *animdata_clips[animdata_ClipKey_COUNT] = {
+  [animdata_ClipKey_Walk       ] = &animdata_walk_clip,
+  [animdata_ClipKey_Turn90Left ] = &animdata_turn90_left_clip,
+  [animdata_ClipKey_Turn90Right] = &animdata_turn90_right_clip,
+};
@@ -0,0 +1,216 @@
+// vim: sw=2 ts=2 expandtab smartindent
+#ifndef blend_IMPLEMENTATION
+
+/* Blend trees: a pose described as clips mixed together, e.g.
+ *
+ *   blend_Tree tree = {0};
+ *   uint8_t turn = blend_clip(&tree, animdata_ClipKey_Turn90Left, turn_t, NULL);
+ *   uint8_t walk = blend_clip(&tree, animdata_ClipKey_Walk,       walk_t, NULL);
+ *   blend_cross_fade(&tree, turn, walk, 0.25f);  // the last node added is the root
+ *
+ * Posing a bunch of trees happens in three steps, so that clip samples can be
+ * shared between trees (a crowd idling in lockstep only samples its idle once):
+ *
+ *  1. blend_gather every tree into a blend_Sampler. Only clips with some weight
+ *     reaching them from the root are gathered, and a clip at a time the sampler
+ *     has already seen is given the sample it already has.
+ *  2. blend_sample everything the sampler gathered (it's a jobs_Fn, so it can be
+ *     spread across the workers).
+ *  3. blend_evaluate each tree; this only mixes the samples, no clip is touched. */
+
+#define blend_MAX_NODES 8
+#define blend_MAX_SAMPLES 4096
+/* must be a power of two, and bigger than blend_MAX_SAMPLES */
+#define blend_TABLE_SIZE 8192
+
+typedef enum {
+  blend_Node_Clip,
+  blend_Node_CrossFade, /* lerp from a to b by weight */
+  blend_Node_Additive,  /* a, plus weight * how far b is from animdata_base_pose */
+} blend_NodeKind;
+
+typedef struct {
+  blend_NodeKind kind;
+
+  /* blend_Node_Clip: seconds into clip, and a cursor for animdata_locate (or NULL) */
+  animdata_ClipKey clip;
+  float t;
+  size_t *cursor;
+  /* blend_Node_Clip: where blend_gather put its pose in the sampler */
+  uint16_t sample;
+
+  /* everything else */
+  uint8_t a, b;
+  float weight;
+} blend_Node;
+
+typedef struct {
+  blend_Node nodes[blend_MAX_NODES];
+  uint8_t count;
+} blend_Tree;
+
+typedef struct {
+  /* every clip/time gathered (and later its pose) */
+  struct {
+    animdata_ClipKey clip;
+    float t;
+    size_t *cursor;
+  } samples[blend_MAX_SAMPLES];
+  f3 poses[blend_MAX_SAMPLES][animdata_JointKey_COUNT];
+  size_t count;
+
+  /* how many clips the trees gathered asked for, shared or not */
+  size_t requested;
+
+  /* open addressing into samples, 0 is empty (so it's index + 1) */
+  uint16_t table[blend_TABLE_SIZE];
+} blend_Sampler;
+
+static uint8_t blend_clip(blend_Tree *tree, animdata_ClipKey clip, float t, size_t *cursor);
+static uint8_t blend_cross_fade(blend_Tree *tree, uint8_t a, uint8_t b, float weight);
+static UNUSED_FN uint8_t blend_additive(blend_Tree *tree, uint8_t base, uint8_t layer, float weight);
+
+static void blend_sampler_reset(blend_Sampler *sampler);
+/* false if the sampler filled up; don't blend_evaluate the tree if so */
+static bool blend_gather(blend_Sampler *sampler, blend_Tree *tree);
+/* a jobs_Fn over [0, sampler->count) */
+static void blend_sample(void *sampler, size_t begin, size_t end);
+static void blend_evaluate(blend_Sampler *sampler, blend_Tree *tree, f3 pose[animdata_JointKey_COUNT]);
+#endif
+
+#ifdef blend_IMPLEMENTATION
+
+static uint8_t blend_push(blend_Tree *tree, blend_Node node) {
+  if (tree->count == blend_MAX_NODES) {
+    log_error("blend tree has more than %d nodes", blend_MAX_NODES);
+    return tree->count - 1;
+  }
+  tree->nodes[tree->count] = node;
+  return tree->count++;
+}
+
+static uint8_t blend_clip(blend_Tree *tree, animdata_ClipKey clip, float t, size_t *cursor) {
+  return blend_push(tree, (blend_Node) { .kind = blend_Node_Clip, .clip = clip, .t = t, .cursor = cursor });
+}
+
+static uint8_t blend_cross_fade(blend_Tree *tree, uint8_t a, uint8_t b, float weight) {
+  return blend_push(tree, (blend_Node) { .kind = blend_Node_CrossFade, .a = a, .b = b, .weight = weight });
+}
+
+static UNUSED_FN uint8_t blend_additive(blend_Tree *tree, uint8_t base, uint8_t layer, float weight) {
+  return blend_push(tree, (blend_Node) { .kind = blend_Node_Additive, .a = base, .b = layer, .weight = weight });
+}
+
+static void blend_sampler_reset(blend_Sampler *sampler) {
+  sampler->count = 0;
+  sampler->requested = 0;
+  SDL_memset(sampler->table, 0, sizeof(sampler->table));
+}
+
+/* finds (or adds) clip at t, returns false if there's no room */
+static bool blend_sampler_find(blend_Sampler *sampler, blend_Node *node) {
+  uint32_t t_bits;
+  SDL_memcpy(&t_bits, &node->t, sizeof(t_bits));
+
+  uint32_t hash = (t_bits ^ (node->clip * 2654435761u)) * 2246822519u;
+  for (uint32_t probe = hash;; probe++) {
+    uint16_t *slot = sampler->table + (probe & (blend_TABLE_SIZE - 1));
+
+    if (*slot == 0) {
+      if (sampler->count == blend_MAX_SAMPLES) return false;
+
+      size_t i = sampler->count++;
+      sampler->samples[i].clip = node->clip;
+      sampler->samples[i].t = node->t;
+      sampler->samples[i].cursor = node->cursor;
+      *slot = i + 1;
+      node->sample = i;
+      return true;
+    }
+
+    size_t i = *slot - 1;
+    if (sampler->samples[i].clip == node->clip && sampler->samples[i].t == node->t) {
+      /* whoever gets here first has their cursor used */
+      if (sampler->samples[i].cursor == NULL) sampler->samples[i].cursor = node->cursor;
+      node->sample = i;
+      return true;
+    }
+  }
+}
+
+static bool blend_gather_node(blend_Sampler *sampler, blend_Tree *tree, uint8_t i) {
+  blend_Node *node = tree->nodes + i;
+  switch (node->kind) {
+    case blend_Node_Clip: {
+      sampler->requested++;
+      return blend_sampler_find(sampler, node);
+    }
+
+    /* a side with no weight doesn't get sampled at all */
+    case blend_Node_CrossFade: {
+      bool ok = true;
+      if (node->weight < 1.0f) ok &= blend_gather_node(sampler, tree, node->a);
+      if (node->weight > 0.0f) ok &= blend_gather_node(sampler, tree, node->b);
+      return ok;
+    }
+
+    case blend_Node_Additive: {
+      bool ok = blend_gather_node(sampler, tree, node->a);
+      if (node->weight != 0.0f) ok &= blend_gather_node(sampler, tree, node->b);
+      return ok;
+    }
+  }
+  return false;
+}
+
+static bool blend_gather(blend_Sampler *sampler, blend_Tree *tree) {
+  if (tree->count == 0) return false;
+  return blend_gather_node(sampler, tree, tree->count - 1);
+}
+
+static void blend_sample(void *data, size_t begin, size_t end) {
+  blend_Sampler *sampler = data;
+  for (size_t i = begin; i < end; i++) {
+    animdata_Clip *clip = animdata_clips[sampler->samples[i].clip];
+    animdata_Key key = animdata_locate(clip, sampler->samples[i].t, sampler->samples[i].cursor);
+    animdata_sample_pose(clip, key, sampler->poses[i]);
+  }
+}
+
+static void blend_evaluate_node(blend_Sampler *sampler, blend_Tree *tree, uint8_t i, f3 pose[animdata_JointKey_COUNT]) {
+  blend_Node *node = tree->nodes + i;
+  switch (node->kind) {
+    case blend_Node_Clip: {
+      SDL_memcpy(pose, sampler->poses[node->sample], sizeof(sampler->poses[0]));
+    } break;
+
+    case blend_Node_CrossFade: {
+      if (node->weight <= 0.0f) { blend_evaluate_node(sampler, tree, node->a, pose); break; }
+      if (node->weight >= 1.0f) { blend_evaluate_node(sampler, tree, node->b, pose); break; }
+
+      f3 a[animdata_JointKey_COUNT], b[animdata_JointKey_COUNT];
+      blend_evaluate_node(sampler, tree, node->a, a);
+      blend_evaluate_node(sampler, tree, node->b, b);
+      animdata_pose_lerp(pose, a, b, node->weight);
+    } break;
+
+    case blend_Node_Additive: {
+      blend_evaluate_node(sampler, tree, node->a, pose);
+      if (node->weight == 0.0f) break;
+
+      f3 layer[animdata_JointKey_COUNT];
+      blend_evaluate_node(sampler, tree, node->b, layer);
+
+      float *out = &pose->x, *l = &layer->x, *base = &animdata_base_pose->x;
+      for (int j = 0; j < animdata_JointKey_COUNT*3; j++)
+        out[j] += (l[j] - base[j])*node->weight;
+    } break;
+  }
+}
+
+static void blend_evaluate(blend_Sampler *sampler, blend_Tree *tree, f3 pose[animdata_JointKey_COUNT]) {
+  if (tree->count == 0) return;
+  blend_evaluate_node(sampler, tree, tree->count - 1, pose);
+}
+
+#endif
@@ -8,21 +8,240 @@ typedef enum {
   cad_InputState_COUNT
 } cad_InputState;
 
-typedef struct cad_Post cad_Post;
-struct cad_Post {
-  cad_Post *next, *last;
-  f2 pos;
-};
+/* Posts and the walls between them live in pools of fixed-size chunks.
+ * A chunk never moves once allocated, so growing never copies anything,
+ * and removed slots go on a free list to be reused.
+ *
+ * They're referred to by handles holding a slot index and that slot's
+ * generation, which is bumped whenever the slot is added to or removed
+ * from, so a handle to something removed just stops being alive instead
+ * of pointing at whatever took its place. The zero handle is never alive. */
+typedef struct { uint32_t bits; } cad_PostId;
+typedef struct { uint32_t bits; } cad_WallId;
+/* (see cad_RoomChunk) */
+typedef struct { uint32_t bits; } cad_RoomId;
+
+#define cad_CHUNK_BITS 10
+#define cad_CHUNK (1 << cad_CHUNK_BITS)
+#define cad_MAX_CHUNKS 64
+/* an index fits in the bottom 16 bits of a handle, the generation in the top */
+#define cad_MAX_SLOTS (cad_CHUNK * cad_MAX_CHUNKS)
+
+/* the posts are as tall as the walls, which are boxes this tall from z = 0 */
+#define cad_POST_HEIGHT 1.4f
+#define cad_WALL_HEIGHT (cad_POST_HEIGHT * 2.0f)
+#define cad_POST_THICK  0.2f
+#define cad_WALL_THICK  0.15f
+
+/* the start of every chunk; odd generations are alive */
+typedef struct {
+  uint16_t gen[cad_CHUNK];
+  uint32_t next_free[cad_CHUNK];
+} cad_Slots;
+
+typedef struct {
+  cad_Slots slots;
+  f2 pos[cad_CHUNK];
+} cad_PostChunk;
+
+typedef struct {
+  cad_Slots slots;
+  cad_PostId a[cad_CHUNK], b[cad_CHUNK];
+  /* its half-edges, a to b and b to a (see cad_RoomChunk) */
+  uint32_t next[cad_CHUNK][2];
+  cad_RoomId room[cad_CHUNK][2];
+} cad_WallChunk;
+
+typedef struct {
+  cad_Slots *chunks[cad_MAX_CHUNKS];
+  /* sizeof(cad_PostChunk) or whichever */
+  size_t chunk_size;
+  uint32_t chunk_count;
+
+  /* slots [0, high) have been handed out at some point; iterate over those */
+  uint32_t high;
+  uint32_t count;
+  /* index + 1 of the first free slot below high, 0 if there isn't one */
+  uint32_t free_head;
+} cad_Pool;
+
+/* Posts and walls are also filed into a uniform grid (hashed, so the world
+ * doesn't need bounds), for finding what's near somewhere without looking
+ * at everything. A wall is filed under every cell it crosses. */
+#define cad_GRID_CELL 2.0f
+#define cad_GRID_BUCKETS 4096 /* must be a power of two */
+#define cad_GRID_MAX_CHUNKS 256
+
+typedef struct {
+  /* the post or wall's handle bits, and which cell it's filed under */
+  uint32_t item[cad_CHUNK];
+  int32_t cell_x[cad_CHUNK], cell_y[cad_CHUNK];
+  /* index + 1 of the next node in the same bucket (or on the free list) */
+  uint32_t next[cad_CHUNK];
+} cad_GridChunk;
+
+typedef struct {
+  /* index + 1 of the first node in each bucket */
+  uint32_t buckets[cad_GRID_BUCKETS];
+
+  cad_GridChunk *chunks[cad_GRID_MAX_CHUNKS];
+  uint32_t chunk_count, high, free_head;
+} cad_Grid;
+
+/* Walls also make a half-edge graph: each wall is a half-edge going each
+ * way, and each half-edge has a room on its left and knows the next one
+ * around that room. Around a post, they're in order of angle, so the rooms
+ * are the faces the walls split the ground into. A room whose edges go
+ * around counterclockwise is enclosed; any other is the outside of a
+ * group of walls (or just a line of them). Adding or removing a wall only
+ * redoes the rooms it touches. Walls only meet at posts; cad_frame won't
+ * place one that crosses another (see cad_wall_crosses).
+ *
+ * Half-edge 2*i goes a to b along wall i, 2*i + 1 goes back. */
+typedef struct {
+  cad_Slots slots;
+  /* a half-edge on its edge */
+  uint32_t first[cad_CHUNK];
+  /* negative or 0 if it isn't enclosed */
+  float area[cad_CHUNK];
+  Box2 bounds[cad_CHUNK];
+} cad_RoomChunk;
+
+/* how many enclosed rooms cad_room_around handles being inside of at once */
+#define cad_ROOM_MAX_NESTED 32
+
+/* A base is saved as a snapshot (cad_FILE_SNAPSHOT) of every slot of both
+ * pools, plus a journal (cad_FILE_JOURNAL) of slots that changed since, so
+ * autosaving only ever appends what changed. When the journal outgrows the
+ * snapshot, they're compacted back into a fresh snapshot.
+ *
+ * Everything is little-endian and fixed-size, with no pointers in it:
+ *
+ *   snapshot: cad_FileHeader
+ *             cad_FileSection[section_count]  where each section is
+ *             ...                             count records of stride bytes
+ *
+ *   journal:  cad_FileHeader (section_count 0)
+ *             cad_FileChange ...              until the end of the file
+ *
+ * A slot record is a slot's generation and what was in it, so loading is a
+ * straight walk over the records, and a change is just a slot record again.
+ * Records are only ever added to the end of, so newer versions can make
+ * them bigger (hence the stride) and older versions will still read them.
+ * The journal goes with the snapshot that has the same id; any other
+ * journal is left over from before the last compaction. */
+#define cad_FILE_SNAPSHOT "base.cad"
+#define cad_FILE_JOURNAL "base.cadj"
+#define cad_FILE_VERSION 1
+/* changes are appended at most this often */
+#define cad_FILE_AUTOSAVE_SECONDS 2.0
+#define cad_FILE_PENDING 256
+/* the journal is compacted when it's bigger than this and the snapshot */
+#define cad_FILE_COMPACT_BYTES (1 << 20)
+
+typedef enum {
+  cad_FileSectionKind_Posts,
+  cad_FileSectionKind_Walls,
+  cad_FileSectionKind_COUNT
+} cad_FileSectionKind;
+
+typedef struct {
+  uint8_t magic[4]; /* "jxcs" for snapshots, "jxcj" for journals */
+  uint32_t version;
+  uint64_t id;
+  uint32_t section_count, _pad;
+} cad_FileHeader;
+
+typedef struct {
+  uint32_t kind, stride;
+  /* from the start of the file */
+  uint64_t offset, count;
+} cad_FileSection;
+
+typedef struct {
+  /* dead slots are saved too, so handles stay the same across a load */
+  uint32_t gen;
+  /* posts: x, y as float bits; walls: the posts' handle bits */
+  uint32_t data[2];
+} cad_FileSlot;
+
+typedef struct {
+  uint32_t kind, index;
+  cad_FileSlot slot;
+} cad_FileChange;
 
 typedef struct {
   bool placing_wall;
+  cad_InputState input;
+  /* the post the wall being placed starts from */
+  cad_PostId placing_from;
+  bool lmb_was_down;
+
+  cad_Pool posts, walls;
+  cad_Grid post_grid, wall_grid;
+
+  cad_Pool rooms;
+  /* no enclosed room goes past this x (it only ever grows) */
+  float room_reach;
 
-  cad_Post posts[10];
-  int      post_count;
+  /* see cad_FileHeader; saving is off if snapshot_path is NULL */
+  struct {
+    char *snapshot_path, *journal_path;
+    SDL_IOStream *journal;
+    uint64_t id, snapshot_bytes, journal_bytes;
 
+    /* changes not yet appended to the journal */
+    cad_FileChange pending[cad_FILE_PENDING];
+    size_t pending_count;
+    double flushed_at;
+
+    /* slots being restored from disk aren't journaled again */
+    bool loading;
+  } file;
 } cad_State;
 
+/* loads the saved base (needs gl_init first, to mesh it) */
+static void cad_init(void);
+/* saves whatever hasn't been */
+static void cad_quit(void);
 static void cad_frame(void);
+
+/* these return the zero handle if the pools are full */
+static cad_PostId cad_post_add(f2 pos);
+static cad_WallId cad_wall_add(cad_PostId a, cad_PostId b);
+/* removing a post removes the walls on it */
+static UNUSED_FN void cad_post_remove(cad_PostId post);
+static void cad_wall_remove(cad_WallId wall);
+
+static bool cad_post_alive(cad_PostId post);
+static UNUSED_FN bool cad_wall_alive(cad_WallId wall);
+static f2 cad_post_pos(cad_PostId post);
+static UNUSED_FN void cad_post_move(cad_PostId post, f2 pos);
+static void cad_wall_posts(cad_WallId wall, cad_PostId *a, cad_PostId *b);
+
+/* the handle to what's in slot i, or the zero handle if it's empty; e.g.
+ *   for (uint32_t i = 0; i < jeux.cad.walls.high; i++) {
+ *     cad_WallId wall = cad_wall_at(i);
+ *     if (wall.bits == 0) continue;
+ *     ...
+ *   } */
+static UNUSED_FN cad_PostId cad_post_at(uint32_t i);
+static UNUSED_FN cad_WallId cad_wall_at(uint32_t i);
+
+/* the closest post within radius of p, or the zero handle */
+static cad_PostId cad_nearest_post(f2 p, float radius);
+/* fills out with up to max walls passing within radius of p, returns how many */
+static size_t cad_walls_near(f2 p, float radius, cad_WallId *out, size_t max);
+/* the first wall hit going from origin to origin + dir (so t in 0 .. 1 is
+ * written to t_out), or the zero handle; walls are cad_WALL_HEIGHT tall */
+static cad_WallId cad_ray_wall(f3 origin, f3 dir, float *t_out);
+
+/* the innermost enclosed room p is in, or the zero handle */
+static UNUSED_FN cad_RoomId cad_room_around(f2 p);
+/* the enclosed rooms on either side of wall (looking from a to b), or zero handles */
+static UNUSED_FN void cad_wall_rooms(cad_WallId wall, cad_RoomId *left, cad_RoomId *right);
+/* 0 once the room is gone (a wall on it was moved, added or removed) */
+static UNUSED_FN float cad_room_area(cad_RoomId room);
 #endif
 
 #ifdef cad_IMPLEMENTATION
@@ -30,35 +249,1242 @@ static void cad_frame(void);
 /* massive hack. praying for forgiveness */
 #define cad (jeux.cad)
 
-static void cad_draw_wall(cad_Post post) {
-  f2 p = post.pos;
-  const float POST_HEIGHT = 1.4f;
-  const float POST_THICK  = 0.2f;
+#define cad_HANDLE(index, gen) (((uint32_t)(gen) << 16) | (index))
+#define cad_HANDLE_INDEX(bits) ((bits) & 0xFFFF)
+#define cad_HANDLE_GEN(bits) ((bits) >> 16)
+#define cad_SLOT(i) ((i) & (cad_CHUNK - 1))
+
+static uint16_t *cad_pool_gen(cad_Pool *pool, uint32_t i) {
+  return pool->chunks[i >> cad_CHUNK_BITS]->gen + (i & (cad_CHUNK - 1));
+}
+
+/* handle bits to slot index + 1, or 0 if what it refers to is gone */
+static uint32_t cad_pool_find(cad_Pool *pool, uint32_t bits) {
+  uint32_t i = cad_HANDLE_INDEX(bits);
+  if (bits == 0 || i >= pool->high) return 0;
+  return (*cad_pool_gen(pool, i) == cad_HANDLE_GEN(bits)) ? i + 1 : 0;
+}
+
+/* returns handle bits, or 0 if the pool is full */
+static uint32_t cad_pool_add(cad_Pool *pool) {
+  uint32_t i;
+  if (pool->free_head) {
+    i = pool->free_head - 1;
+    pool->free_head = pool->chunks[i >> cad_CHUNK_BITS]->next_free[i & (cad_CHUNK - 1)];
+  } else {
+    if (pool->high == cad_MAX_SLOTS) {
+      log_warn("cad: can't have more than %d of these", cad_MAX_SLOTS);
+      return 0;
+    }
+
+    i = pool->high;
+    if ((i >> cad_CHUNK_BITS) == pool->chunk_count) {
+      cad_Slots *chunk = SDL_calloc(1, pool->chunk_size);
+      if (chunk == NULL) {
+        log_error("cad: out of memory");
+        return 0;
+      }
+      pool->chunks[pool->chunk_count++] = chunk;
+    }
+    pool->high++;
+  }
+
+  uint16_t *gen = cad_pool_gen(pool, i);
+  (*gen)++;
+  pool->count++;
+  return cad_HANDLE(i, *gen);
+}
+
+static void cad_pool_remove(cad_Pool *pool, uint32_t i) {
+  (*cad_pool_gen(pool, i))++;
+  pool->chunks[i >> cad_CHUNK_BITS]->next_free[i & (cad_CHUNK - 1)] = pool->free_head;
+  pool->free_head = i + 1;
+  pool->count--;
+}
+
+static uint32_t cad_pool_at(cad_Pool *pool, uint32_t i) {
+  uint16_t gen = *cad_pool_gen(pool, i);
+  return (gen & 1) ? cad_HANDLE(i, gen) : 0;
+}
+
+/* MARK: grid { */
+
+#define cad_GRID_NODE(grid, i) (grid)->chunks[(i) >> cad_CHUNK_BITS]
+#define cad_GRID_BUCKET(grid, x, y) \
+  ((grid)->buckets + ((((uint32_t)(x) * 73856093u) ^ ((uint32_t)(y) * 19349663u)) & (cad_GRID_BUCKETS - 1)))
+
+static int32_t cad_grid_cell(float v) { return (int32_t)floorf(v / cad_GRID_CELL); }
+
+static void cad_grid_insert(cad_Grid *grid, int32_t x, int32_t y, uint32_t item) {
+  uint32_t i;
+  if (grid->free_head) {
+    i = grid->free_head - 1;
+    grid->free_head = cad_GRID_NODE(grid, i)->next[cad_SLOT(i)];
+  } else {
+    i = grid->high;
+    if ((i >> cad_CHUNK_BITS) == grid->chunk_count) {
+      if (grid->chunk_count == cad_GRID_MAX_CHUNKS) {
+        log_warn("cad: grid is full, %d isn't findable", item);
+        return;
+      }
+      cad_GridChunk *chunk = SDL_calloc(1, sizeof(cad_GridChunk));
+      if (chunk == NULL) {
+        log_error("cad: out of memory");
+        return;
+      }
+      grid->chunks[grid->chunk_count++] = chunk;
+    }
+    grid->high++;
+  }
+
+  cad_GridChunk *chunk = cad_GRID_NODE(grid, i);
+  uint32_t *bucket = cad_GRID_BUCKET(grid, x, y);
+  chunk->item  [cad_SLOT(i)] = item;
+  chunk->cell_x[cad_SLOT(i)] = x;
+  chunk->cell_y[cad_SLOT(i)] = y;
+  chunk->next  [cad_SLOT(i)] = *bucket;
+  *bucket = i + 1;
+}
+
+static void cad_grid_remove(cad_Grid *grid, int32_t x, int32_t y, uint32_t item) {
+  for (uint32_t *link = cad_GRID_BUCKET(grid, x, y); *link;) {
+    uint32_t i = *link - 1;
+    cad_GridChunk *chunk = cad_GRID_NODE(grid, i);
+    if (chunk->item  [cad_SLOT(i)] != item ||
+        chunk->cell_x[cad_SLOT(i)] != x    ||
+        chunk->cell_y[cad_SLOT(i)] != y) {
+      link = chunk->next + cad_SLOT(i);
+      continue;
+    }
+
+    *link = chunk->next[cad_SLOT(i)];
+    chunk->next[cad_SLOT(i)] = grid->free_head;
+    grid->free_head = i + 1;
+    return;
+  }
+}
+
+/* Walks the cells from a's to b's, a step along one axis at a time, so
+ * inserting and removing the same segment always agree on its cells. It
+ * always ends up in b's cell, even if rounding would have it step along
+ * the wrong axis at a corner. Returns false when it's done. */
+typedef struct {
+  int32_t x, y, step_x, step_y;
+  float t_max_x, t_max_y, t_delta_x, t_delta_y;
+  int steps_x, steps_y;
+} cad_GridWalk;
+
+static cad_GridWalk cad_grid_walk(f2 a, f2 b) {
+  cad_GridWalk walk = { .x = cad_grid_cell(a.x), .y = cad_grid_cell(a.y) };
+  float dx = b.x - a.x, dy = b.y - a.y;
+  walk.step_x = (dx >= 0) ? 1 : -1;
+  walk.step_y = (dy >= 0) ? 1 : -1;
+  walk.steps_x = abs(cad_grid_cell(b.x) - walk.x);
+  walk.steps_y = abs(cad_grid_cell(b.y) - walk.y);
+
+  walk.t_max_x   = (dx != 0) ? ((walk.x + (dx > 0)) * cad_GRID_CELL - a.x) / dx : INFINITY;
+  walk.t_max_y   = (dy != 0) ? ((walk.y + (dy > 0)) * cad_GRID_CELL - a.y) / dy : INFINITY;
+  walk.t_delta_x = (dx != 0) ? cad_GRID_CELL / fabsf(dx) : INFINITY;
+  walk.t_delta_y = (dy != 0) ? cad_GRID_CELL / fabsf(dy) : INFINITY;
+  return walk;
+}
+
+static bool cad_grid_walk_next(cad_GridWalk *walk) {
+  if (walk->steps_x == 0 && walk->steps_y == 0) return false;
+  if (walk->steps_y == 0 || (walk->steps_x > 0 && walk->t_max_x < walk->t_max_y)) {
+    walk->t_max_x += walk->t_delta_x;
+    walk->x += walk->step_x;
+    walk->steps_x--;
+  } else {
+    walk->t_max_y += walk->t_delta_y;
+    walk->y += walk->step_y;
+    walk->steps_y--;
+  }
+  return true;
+}
+
+static void cad_room_link(uint32_t wall, bool link);
+static void cad_rooms_rebuild(void);
+
+static void cad_grid_wall(f2 a, f2 b, uint32_t wall, bool insert) {
+  cad_GridWalk walk = cad_grid_walk(a, b);
+  do {
+    if (insert) cad_grid_insert(&cad.wall_grid, walk.x, walk.y, wall);
+    else        cad_grid_remove(&cad.wall_grid, walk.x, walk.y, wall);
+  } while (cad_grid_walk_next(&walk));
+
+  /* only walls that are filed are in the half-edge graph */
+  cad_room_link(cad_HANDLE_INDEX(wall), insert);
+
+  /* everyone has to go around it too */
+  nav_wall(a, b, insert);
+}
+
+/* } MARK */
+
+#define cad_POST_CHUNK(i) ((cad_PostChunk *)cad.posts.chunks[(i) >> cad_CHUNK_BITS])
+#define cad_WALL_CHUNK(i) ((cad_WallChunk *)cad.walls.chunks[(i) >> cad_CHUNK_BITS])
+
+/* MARK: meshes { */
+
+/* post i is CAD box 2*i, wall i is box 2*i + 1 (see gl_State.cad_boxes) */
+#define cad_POST_BOX(i) ((size_t)(i)*2)
+#define cad_WALL_BOX(i) ((size_t)(i)*2 + 1)
+
+static void cad_mesh_post(uint32_t i) {
+  gl_cad_Instance inst = {0};
+  if (cad_pool_at(&cad.posts, i)) {
+    f2 p = cad_POST_CHUNK(i)->pos[cad_SLOT(i)];
+    inst.from = (f2) { p.x - cad_POST_THICK, p.y };
+    inst.to   = (f2) { p.x + cad_POST_THICK, p.y };
+    inst.thickness = cad_POST_THICK * 2.0f;
+    inst.height = cad_WALL_HEIGHT;
+  }
+  gl_cad_set(cad_POST_BOX(i), inst);
+}
+
+static void cad_mesh_wall(uint32_t i) {
+  gl_cad_Instance inst = {0};
+  if (cad_pool_at(&cad.walls, i)) {
+    inst.from = cad_post_pos(cad_WALL_CHUNK(i)->a[cad_SLOT(i)]);
+    inst.to   = cad_post_pos(cad_WALL_CHUNK(i)->b[cad_SLOT(i)]);
+    inst.thickness = cad_WALL_THICK;
+    inst.height = cad_WALL_HEIGHT;
+  }
+  gl_cad_set(cad_WALL_BOX(i), inst);
+}
+
+/* } MARK */
+
+/* MARK: save { */
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define cad_FILE_MMAP
+#endif
+
+#define cad_FILE_SNAPSHOT_MAGIC "jxcs"
+#define cad_FILE_JOURNAL_MAGIC "jxcj"
+
+/* a whole file, read-only; mapped where we can, otherwise read in one go */
+typedef struct {
+  const uint8_t *data;
+  size_t size;
+} cad_FileView;
+
+static bool cad_file_view(const char *path, cad_FileView *view) {
+  *view = (cad_FileView) {0};
+#ifdef cad_FILE_MMAP
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) return false;
+
+  struct stat st;
+  if (fstat(fd, &st) == 0 && st.st_size > 0) {
+    void *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data != MAP_FAILED) {
+      view->data = data;
+      view->size = st.st_size;
+    }
+  }
+  close(fd);
+#else
+  view->data = SDL_LoadFile(path, &view->size);
+#endif
+  return view->data != NULL;
+}
+
+static void cad_file_unview(cad_FileView *view) {
+#ifdef cad_FILE_MMAP
+  if (view->data) munmap((void *)view->data, view->size);
+#else
+  SDL_free((void *)view->data);
+#endif
+  *view = (cad_FileView) {0};
+}
+
+/* to and from the file's byte order (they're the same thing both ways) */
+static cad_FileHeader cad_file_header_le(cad_FileHeader h) {
+  h.version       = SDL_Swap32LE(h.version);
+  h.id            = SDL_Swap64LE(h.id);
+  h.section_count = SDL_Swap32LE(h.section_count);
+  return h;
+}
+static cad_FileSection cad_file_section_le(cad_FileSection s) {
+  s.kind   = SDL_Swap32LE(s.kind);
+  s.stride = SDL_Swap32LE(s.stride);
+  s.offset = SDL_Swap64LE(s.offset);
+  s.count  = SDL_Swap64LE(s.count);
+  return s;
+}
+static cad_FileSlot cad_file_slot_le(cad_FileSlot s) {
+  s.gen     = SDL_Swap32LE(s.gen);
+  s.data[0] = SDL_Swap32LE(s.data[0]);
+  s.data[1] = SDL_Swap32LE(s.data[1]);
+  return s;
+}
+static cad_FileChange cad_file_change_le(cad_FileChange c) {
+  c.kind  = SDL_Swap32LE(c.kind);
+  c.index = SDL_Swap32LE(c.index);
+  c.slot  = cad_file_slot_le(c.slot);
+  return c;
+}
+
+static cad_Pool *cad_file_pool(cad_FileSectionKind kind) {
+  return (kind == cad_FileSectionKind_Posts) ? &cad.posts : &cad.walls;
+}
+
+static cad_FileSlot cad_file_slot(cad_FileSectionKind kind, uint32_t i) {
+  cad_FileSlot slot = { .gen = *cad_pool_gen(cad_file_pool(kind), i) };
+  if (kind == cad_FileSectionKind_Posts) {
+    f2 pos = cad_POST_CHUNK(i)->pos[cad_SLOT(i)];
+    SDL_memcpy(slot.data + 0, &pos.x, sizeof(float));
+    SDL_memcpy(slot.data + 1, &pos.y, sizeof(float));
+  } else {
+    slot.data[0] = cad_WALL_CHUNK(i)->a[cad_SLOT(i)].bits;
+    slot.data[1] = cad_WALL_CHUNK(i)->b[cad_SLOT(i)].bits;
+  }
+  return slot;
+}
+
+/* makes sure slot i exists, for putting something back exactly where it was */
+static bool cad_pool_reserve(cad_Pool *pool, uint32_t i) {
+  if (i >= cad_MAX_SLOTS) return false;
+  while ((i >> cad_CHUNK_BITS) >= pool->chunk_count) {
+    cad_Slots *chunk = SDL_calloc(1, pool->chunk_size);
+    if (chunk == NULL) {
+      log_error("cad: out of memory");
+      return false;
+    }
+    pool->chunks[pool->chunk_count++] = chunk;
+  }
+  if (pool->high <= i) pool->high = i + 1;
+  return true;
+}
+
+/* after putting slots back in whatever order, the free list needs redoing */
+static void cad_pool_refree(cad_Pool *pool) {
+  pool->free_head = 0;
+  for (uint32_t i = pool->high; i-- > 0;) {
+    if (*cad_pool_gen(pool, i) & 1) continue;
+    pool->chunks[i >> cad_CHUNK_BITS]->next_free[cad_SLOT(i)] = pool->free_head;
+    pool->free_head = i + 1;
+  }
+}
+
+/* writes everything out as a new snapshot, and starts a new journal to go with it */
+static void cad_file_compact(void) {
+  if (cad.file.snapshot_path == NULL) return;
+  if (cad.file.journal) {
+    SDL_CloseIO(cad.file.journal);
+    cad.file.journal = NULL;
+  }
+  /* they're all in the snapshot */
+  cad.file.pending_count = 0;
+
+  uint64_t id = cad.file.id + 1;
+  size_t size = sizeof(cad_FileHeader) + cad_FileSectionKind_COUNT*sizeof(cad_FileSection) +
+                (cad.posts.high + cad.walls.high)*sizeof(cad_FileSlot);
+  uint8_t *buf = SDL_malloc(size);
+  if (buf == NULL) {
+    log_error("cad: out of memory");
+    return;
+  }
+
+  {
+    uint8_t *p = buf;
+
+    cad_FileHeader header = { .version = cad_FILE_VERSION, .id = id, .section_count = cad_FileSectionKind_COUNT };
+    SDL_memcpy(header.magic, cad_FILE_SNAPSHOT_MAGIC, sizeof(header.magic));
+    header = cad_file_header_le(header);
+    SDL_memcpy(p, &header, sizeof(header));
+    p += sizeof(header);
+
+    uint64_t offset = sizeof(cad_FileHeader) + cad_FileSectionKind_COUNT*sizeof(cad_FileSection);
+    for (int kind = 0; kind < cad_FileSectionKind_COUNT; kind++) {
+      uint32_t count = cad_file_pool(kind)->high;
+      cad_FileSection section = { kind, sizeof(cad_FileSlot), offset, count };
+      section = cad_file_section_le(section);
+      SDL_memcpy(p, &section, sizeof(section));
+      p += sizeof(section);
+      offset += count*sizeof(cad_FileSlot);
+    }
+
+    for (int kind = 0; kind < cad_FileSectionKind_COUNT; kind++)
+      for (uint32_t i = 0; i < cad_file_pool(kind)->high; i++) {
+        cad_FileSlot slot = cad_file_slot_le(cad_file_slot(kind, i));
+        SDL_memcpy(p, &slot, sizeof(slot));
+        p += sizeof(slot);
+      }
+  }
+
+  /* written off to the side first, so there's always a whole snapshot there */
+  char *tmp_path = NULL;
+  bool ok = SDL_asprintf(&tmp_path, "%s.tmp", cad.file.snapshot_path) >= 0 &&
+            SDL_SaveFile(tmp_path, buf, size) &&
+            SDL_RenamePath(tmp_path, cad.file.snapshot_path);
+  SDL_free(tmp_path);
+  SDL_free(buf);
+  if (!ok) {
+    log_error("cad: couldn't save %s: %s", cad.file.snapshot_path, SDL_GetError());
+    return;
+  }
+  cad.file.id = id;
+  cad.file.snapshot_bytes = size;
+
+  /* the old journal's id doesn't match anymore, so it's safe to start over */
+  cad_FileHeader header = { .version = cad_FILE_VERSION, .id = id };
+  SDL_memcpy(header.magic, cad_FILE_JOURNAL_MAGIC, sizeof(header.magic));
+  header = cad_file_header_le(header);
+
+  cad.file.journal = SDL_IOFromFile(cad.file.journal_path, "wb");
+  if (cad.file.journal == NULL ||
+      SDL_WriteIO(cad.file.journal, &header, sizeof(header)) != sizeof(header) ||
+      !SDL_FlushIO(cad.file.journal)) {
+    log_error("cad: couldn't save %s: %s", cad.file.journal_path, SDL_GetError());
+    if (cad.file.journal) SDL_CloseIO(cad.file.journal);
+    cad.file.journal = NULL;
+    return;
+  }
+  cad.file.journal_bytes = sizeof(header);
+}
+
+/* appends the pending changes to the journal */
+static void cad_file_flush(void) {
+  cad.file.flushed_at = jeux.elapsed;
+
+  /* if the journal went away, everything gets saved again from scratch */
+  if (cad.file.journal == NULL) {
+    cad_file_compact();
+    return;
+  }
+
+  if (cad.file.pending_count > 0) {
+    cad_FileChange out[cad_FILE_PENDING];
+    for (size_t i = 0; i < cad.file.pending_count; i++)
+      out[i] = cad_file_change_le(cad.file.pending[i]);
+
+    size_t bytes = cad.file.pending_count*sizeof(cad_FileChange);
+    cad.file.pending_count = 0;
+    if (SDL_WriteIO(cad.file.journal, out, bytes) != bytes || !SDL_FlushIO(cad.file.journal)) {
+      log_error("cad: couldn't save %s: %s", cad.file.journal_path, SDL_GetError());
+      cad_file_compact();
+      return;
+    }
+    cad.file.journal_bytes += bytes;
+  }
+
+  if (cad.file.journal_bytes > cad_FILE_COMPACT_BYTES && cad.file.journal_bytes > cad.file.snapshot_bytes)
+    cad_file_compact();
+}
+
+static void cad_file_change(cad_FileSectionKind kind, uint32_t i) {
+  if (cad.file.loading || cad.file.snapshot_path == NULL) return;
+
+  cad_FileChange change = { kind, i, cad_file_slot(kind, i) };
+
+  /* dragging something about changes it every frame; only the last one matters */
+  if (cad.file.pending_count > 0) {
+    cad_FileChange *last = cad.file.pending + cad.file.pending_count - 1;
+    if (last->kind == change.kind && last->index == change.index) {
+      *last = change;
+      return;
+    }
+  }
+
+  if (cad.file.pending_count == cad_FILE_PENDING) cad_file_flush();
+  cad.file.pending[cad.file.pending_count++] = change;
+}
+
+/* slot i changed, so it needs meshing and saving */
+static void cad_post_changed(uint32_t i) {
+  cad_mesh_post(i);
+  cad_file_change(cad_FileSectionKind_Posts, i);
+}
+static void cad_wall_changed(uint32_t i) {
+  cad_mesh_wall(i);
+  cad_file_change(cad_FileSectionKind_Walls, i);
+}
+
+/* puts slot i back the way a file says it was */
+static void cad_file_restore(cad_FileSectionKind kind, uint32_t i, cad_FileSlot slot) {
+  if (!cad_pool_reserve(cad_file_pool(kind), i)) return;
+  uint16_t *gen = cad_pool_gen(cad_file_pool(kind), i);
+
+  if (kind == cad_FileSectionKind_Posts) {
+    f2 pos;
+    SDL_memcpy(&pos.x, slot.data + 0, sizeof(float));
+    SDL_memcpy(&pos.y, slot.data + 1, sizeof(float));
+
+    cad_PostId now = { cad_pool_at(&cad.posts, i) };
+    if (now.bits && cad_HANDLE_GEN(now.bits) == slot.gen) {
+      cad_post_move(now, pos);
+      return;
+    }
+    if (now.bits) cad_post_remove(now);
+
+    *gen = slot.gen;
+    if (*gen & 1) {
+      cad.posts.count++;
+      cad_POST_CHUNK(i)->pos[cad_SLOT(i)] = pos;
+      cad_grid_insert(&cad.post_grid, cad_grid_cell(pos.x), cad_grid_cell(pos.y), cad_HANDLE(i, *gen));
+    }
+    cad_post_changed(i);
+  } else {
+    cad_PostId a = { slot.data[0] }, b = { slot.data[1] };
+
+    cad_WallId now = { cad_pool_at(&cad.walls, i) };
+    if (now.bits) cad_wall_remove(now);
+
+    /* a wall can't outlive its posts */
+    *gen = slot.gen;
+    if ((*gen & 1) && (!cad_post_alive(a) || !cad_post_alive(b))) (*gen)++;
+
+    if (*gen & 1) {
+      cad.walls.count++;
+      cad_WALL_CHUNK(i)->a[cad_SLOT(i)] = a;
+      cad_WALL_CHUNK(i)->b[cad_SLOT(i)] = b;
+      cad_grid_wall(cad_post_pos(a), cad_post_pos(b), cad_HANDLE(i, *gen), true);
+    }
+    cad_wall_changed(i);
+  }
+}
+
+static bool cad_file_header(cad_FileView view, const char *magic, cad_FileHeader *header) {
+  if (view.size < sizeof(*header)) return false;
+  SDL_memcpy(header, view.data, sizeof(*header));
+  *header = cad_file_header_le(*header);
+  return SDL_memcmp(header->magic, magic, sizeof(header->magic)) == 0 &&
+         header->version > 0 && header->version <= cad_FILE_VERSION;
+}
+
+static bool cad_file_load_snapshot(cad_FileView view) {
+  cad_FileHeader header;
+  if (!cad_file_header(view, cad_FILE_SNAPSHOT_MAGIC, &header)) return false;
+  if (header.section_count > (view.size - sizeof(header)) / sizeof(cad_FileSection)) return false;
+
+  /* make sure it all fits before touching anything */
+  for (uint32_t s = 0; s < header.section_count; s++) {
+    cad_FileSection section;
+    SDL_memcpy(&section, view.data + sizeof(header) + s*sizeof(section), sizeof(section));
+    section = cad_file_section_le(section);
+    if (section.stride < sizeof(cad_FileSlot) ||
+        section.offset > view.size ||
+        section.count > cad_MAX_SLOTS ||
+        section.count > (view.size - section.offset) / section.stride) return false;
+  }
+
+  /* posts first, the walls need them */
+  for (int kind = 0; kind < cad_FileSectionKind_COUNT; kind++)
+    for (uint32_t s = 0; s < header.section_count; s++) {
+      cad_FileSection section;
+      SDL_memcpy(&section, view.data + sizeof(header) + s*sizeof(section), sizeof(section));
+      section = cad_file_section_le(section);
+      if (section.kind != (uint32_t)kind) continue;
+
+      const uint8_t *record = view.data + section.offset;
+      for (uint32_t i = 0; i < section.count; i++, record += section.stride) {
+        cad_FileSlot slot;
+        SDL_memcpy(&slot, record, sizeof(slot));
+        cad_file_restore(kind, i, cad_file_slot_le(slot));
+      }
+    }
+
+  cad.file.id = header.id;
+  return true;
+}
+
+/* false if the journal can't be added on to */
+static bool cad_file_load_journal(cad_FileView view) {
+  cad_FileHeader header;
+  if (!cad_file_header(view, cad_FILE_JOURNAL_MAGIC, &header)) return false;
+  /* left over from before the snapshot was last rewritten; it's all in there */
+  if (header.id != cad.file.id) return false;
+
+  size_t count = (view.size - sizeof(header)) / sizeof(cad_FileChange);
+  for (size_t i = 0; i < count; i++) {
+    cad_FileChange change;
+    SDL_memcpy(&change, view.data + sizeof(header) + i*sizeof(change), sizeof(change));
+    change = cad_file_change_le(change);
+    if (change.kind < cad_FileSectionKind_COUNT) cad_file_restore(change.kind, change.index, change.slot);
+  }
+
+  /* a change cut off partway through (by a crash, say) would misalign what comes after it */
+  return (view.size - sizeof(header)) % sizeof(cad_FileChange) == 0;
+}
+
+/* stops saving, without saving anything */
+static void cad_file_off(void) {
+  if (cad.file.journal) SDL_CloseIO(cad.file.journal);
+  SDL_free(cad.file.snapshot_path);
+  SDL_free(cad.file.journal_path);
+  cad.file.journal = NULL;
+  cad.file.snapshot_path = cad.file.journal_path = NULL;
+}
+
+static void cad_init(void) {
+  char *pref = SDL_GetPrefPath("jeux", "jeu desprit");
+  if (pref == NULL) {
+    log_warn("cad: nowhere to save bases: %s", SDL_GetError());
+    return;
+  }
+  if (SDL_asprintf(&cad.file.snapshot_path, "%s%s", pref, cad_FILE_SNAPSHOT) < 0 ||
+      SDL_asprintf(&cad.file.journal_path,  "%s%s", pref, cad_FILE_JOURNAL ) < 0) {
+    log_error("cad: out of memory");
+    cad_file_off();
+  }
+  SDL_free(pref);
+  if (cad.file.snapshot_path == NULL) return;
+
+  cad.file.loading = true;
+
+  cad_FileView view;
+  if (cad_file_view(cad.file.snapshot_path, &view)) {
+    bool ok = cad_file_load_snapshot(view);
+    cad.file.snapshot_bytes = view.size;
+    cad_file_unview(&view);
+
+    if (!ok) {
+      /* don't write over what might be from a newer version */
+      log_error("cad: can't load %s, so it won't be saved over", cad.file.snapshot_path);
+      cad.file.loading = false;
+      cad_file_off();
+      return;
+    }
+  }
+
+  bool journal_ok = false;
+  if (cad_file_view(cad.file.journal_path, &view)) {
+    journal_ok = cad_file_load_journal(view);
+    cad.file.journal_bytes = view.size;
+    cad_file_unview(&view);
+  }
+
+  cad_pool_refree(&cad.posts);
+  cad_pool_refree(&cad.walls);
+  cad.file.loading = false;
+  cad_rooms_rebuild();
+
+  if (journal_ok) cad.file.journal = SDL_IOFromFile(cad.file.journal_path, "ab");
+  if (cad.file.journal == NULL) cad_file_compact();
+}
+
+static void cad_quit(void) {
+  if (cad.file.snapshot_path) cad_file_flush();
+  cad_file_off();
+}
+
+/* } MARK */
+
+static cad_PostId cad_post_add(f2 pos) {
+  cad_PostId post = { cad_pool_add(&cad.posts) };
+  if (post.bits) {
+    uint32_t i = cad_HANDLE_INDEX(post.bits);
+    cad_POST_CHUNK(i)->pos[cad_SLOT(i)] = pos;
+    cad_grid_insert(&cad.post_grid, cad_grid_cell(pos.x), cad_grid_cell(pos.y), post.bits);
+    cad_post_changed(i);
+  }
+  return post;
+}
+
+static cad_WallId cad_wall_add(cad_PostId a, cad_PostId b) {
+  if (!cad_post_alive(a) || !cad_post_alive(b)) return (cad_WallId) {0};
+
+  cad_WallId wall = { cad_pool_add(&cad.walls) };
+  if (wall.bits) {
+    uint32_t i = cad_HANDLE_INDEX(wall.bits);
+    cad_WALL_CHUNK(i)->a[cad_SLOT(i)] = a;
+    cad_WALL_CHUNK(i)->b[cad_SLOT(i)] = b;
+    cad_grid_wall(cad_post_pos(a), cad_post_pos(b), wall.bits, true);
+    cad_wall_changed(i);
+  }
+  return wall;
+}
+
+static void cad_wall_remove(cad_WallId wall) {
+  uint32_t i = cad_pool_find(&cad.walls, wall.bits);
+  if (i == 0) return;
+
+  cad_PostId a, b;
+  cad_wall_posts(wall, &a, &b);
+  cad_grid_wall(cad_post_pos(a), cad_post_pos(b), wall.bits, false);
+  cad_pool_remove(&cad.walls, i - 1);
+  cad_wall_changed(i - 1);
+}
+
+/* every wall on a post goes through the post's cell */
+#define cad_POST_MAX_WALLS 64
+static size_t cad_post_walls(cad_PostId post, cad_WallId out[cad_POST_MAX_WALLS]) {
+  f2 p = cad_post_pos(post);
+  int32_t x = cad_grid_cell(p.x), y = cad_grid_cell(p.y);
+
+  size_t count = 0;
+  for (uint32_t node = *cad_GRID_BUCKET(&cad.wall_grid, x, y); node;) {
+    cad_GridChunk *chunk = cad_GRID_NODE(&cad.wall_grid, node - 1);
+    uint32_t slot = cad_SLOT(node - 1);
+    node = chunk->next[slot];
+    if (chunk->cell_x[slot] != x || chunk->cell_y[slot] != y) continue;
+
+    cad_WallId wall = { chunk->item[slot] };
+    cad_PostId a, b;
+    cad_wall_posts(wall, &a, &b);
+    if (a.bits != post.bits && b.bits != post.bits) continue;
+
+    if (count == cad_POST_MAX_WALLS) {
+      log_warn("cad: post has more than %d walls", cad_POST_MAX_WALLS);
+      break;
+    }
+    out[count++] = wall;
+  }
+  return count;
+}
+
+static UNUSED_FN void cad_post_remove(cad_PostId post) {
+  uint32_t i = cad_pool_find(&cad.posts, post.bits);
+  if (i == 0) return;
+
+  cad_WallId walls[cad_POST_MAX_WALLS];
+  size_t wall_count = cad_post_walls(post, walls);
+  for (size_t w = 0; w < wall_count; w++) cad_wall_remove(walls[w]);
+
+  f2 p = cad_post_pos(post);
+  cad_grid_remove(&cad.post_grid, cad_grid_cell(p.x), cad_grid_cell(p.y), post.bits);
+  cad_pool_remove(&cad.posts, i - 1);
+  cad_post_changed(i - 1);
+}
+
+static bool cad_post_alive(cad_PostId post) { return cad_pool_find(&cad.posts, post.bits) != 0; }
+static UNUSED_FN bool cad_wall_alive(cad_WallId wall) { return cad_pool_find(&cad.walls, wall.bits) != 0; }
+
+static f2 cad_post_pos(cad_PostId post) {
+  uint32_t i = cad_pool_find(&cad.posts, post.bits);
+  if (i-- == 0) return (f2) {0};
+  return cad_POST_CHUNK(i)->pos[cad_SLOT(i)];
+}
+
+static UNUSED_FN void cad_post_move(cad_PostId post, f2 pos) {
+  uint32_t i = cad_pool_find(&cad.posts, post.bits);
+  if (i-- == 0) return;
+
+  /* refile it and its walls */
+  cad_WallId walls[cad_POST_MAX_WALLS];
+  size_t wall_count = cad_post_walls(post, walls);
+  for (size_t w = 0; w < wall_count; w++) {
+    cad_PostId a, b;
+    cad_wall_posts(walls[w], &a, &b);
+    cad_grid_wall(cad_post_pos(a), cad_post_pos(b), walls[w].bits, false);
+  }
+  f2 *p = cad_POST_CHUNK(i)->pos + cad_SLOT(i);
+  cad_grid_remove(&cad.post_grid, cad_grid_cell(p->x), cad_grid_cell(p->y), post.bits);
+
+  *p = pos;
+
+  cad_grid_insert(&cad.post_grid, cad_grid_cell(p->x), cad_grid_cell(p->y), post.bits);
+  cad_post_changed(i);
+  for (size_t w = 0; w < wall_count; w++) {
+    cad_PostId a, b;
+    cad_wall_posts(walls[w], &a, &b);
+    cad_grid_wall(cad_post_pos(a), cad_post_pos(b), walls[w].bits, true);
+    cad_wall_changed(cad_HANDLE_INDEX(walls[w].bits));
+  }
+}
+
+static void cad_wall_posts(cad_WallId wall, cad_PostId *a, cad_PostId *b) {
+  uint32_t i = cad_pool_find(&cad.walls, wall.bits);
+  if (i-- == 0) {
+    *a = *b = (cad_PostId) {0};
+    return;
+  }
+  *a = cad_WALL_CHUNK(i)->a[cad_SLOT(i)];
+  *b = cad_WALL_CHUNK(i)->b[cad_SLOT(i)];
+}
+
+static UNUSED_FN cad_PostId cad_post_at(uint32_t i) { return (cad_PostId) { cad_pool_at(&cad.posts, i) }; }
+static UNUSED_FN cad_WallId cad_wall_at(uint32_t i) { return (cad_WallId) { cad_pool_at(&cad.walls, i) }; }
+
+/* MARK: rooms { */
+
+#define cad_ROOM_CHUNK(i) ((cad_RoomChunk *)cad.rooms.chunks[(i) >> cad_CHUNK_BITS])
+#define cad_HALF_WALL(h) ((h) >> 1)
+#define cad_HALF_TWIN(h) ((h) ^ 1)
+
+static uint32_t *cad_half_next(uint32_t h) {
+  return &cad_WALL_CHUNK(cad_HALF_WALL(h))->next[cad_SLOT(cad_HALF_WALL(h))][h & 1];
+}
+
+static cad_RoomId *cad_half_room(uint32_t h) {
+  return &cad_WALL_CHUNK(cad_HALF_WALL(h))->room[cad_SLOT(cad_HALF_WALL(h))][h & 1];
+}
+
+/* the post h starts from */
+static cad_PostId cad_half_post(uint32_t h) {
+  cad_WallChunk *chunk = cad_WALL_CHUNK(cad_HALF_WALL(h));
+  return (h & 1) ? chunk->b[cad_SLOT(cad_HALF_WALL(h))] : chunk->a[cad_SLOT(cad_HALF_WALL(h))];
+}
+
+static float cad_half_angle(uint32_t h) {
+  f2 from = cad_post_pos(cad_half_post(h)), to = cad_post_pos(cad_half_post(cad_HALF_TWIN(h)));
+  return atan2f(to.y - from.y, to.x - from.x);
+}
+
+/* fills out with the half-edges leaving post, except along wall skip */
+static size_t cad_post_halves(cad_PostId post, uint32_t skip, uint32_t out[cad_POST_MAX_WALLS]) {
+  cad_WallId walls[cad_POST_MAX_WALLS];
+  size_t wall_count = cad_post_walls(post, walls), count = 0;
+  for (size_t w = 0; w < wall_count; w++) {
+    uint32_t i = cad_HANDLE_INDEX(walls[w].bits);
+    cad_WallChunk *chunk = cad_WALL_CHUNK(i);
+    /* a wall from a post to itself has no angle, so it isn't in the graph */
+    if (i == skip || chunk->a[cad_SLOT(i)].bits == chunk->b[cad_SLOT(i)].bits) continue;
+    out[count++] = i*2 + (chunk->a[cad_SLOT(i)].bits != post.bits);
+  }
+  return count;
+}
+
+/* Puts h into the order around its post, right after the half-edge
+ * leaving counterclockwise of it. Returns the half-edge that turned onto
+ * that one and now turns onto h instead, or h if h's post had no others. */
+static uint32_t cad_half_link(uint32_t h) {
+  cad_PostId post = cad_half_post(h), other = cad_half_post(cad_HALF_TWIN(h));
+  uint32_t out[cad_POST_MAX_WALLS];
+  size_t count = cad_post_halves(post, cad_HALF_WALL(h), out);
+
+  uint32_t ccw = h, same = h;
+  for (size_t o = 0; o < count; o++)
+    if (cad_half_post(cad_HALF_TWIN(out[o])).bits == other.bits && (same == h || out[o] < same)) same = out[o];
+
+  if (same != h) {
+    /* There's already a wall between these posts, at the same angle. It goes
+     * right alongside that one, on the same side of it at both ends (so
+     * counterclockwise of it at a and clockwise at b), or they'd cross. */
+    ccw = same;
+    if ((h & 1) == 0)
+      for (size_t o = 0; o < count; o++)
+        if (*cad_half_next(cad_HALF_TWIN(out[o])) == same) ccw = out[o];
+  } else {
+    float angle = cad_half_angle(h), best_turn = INFINITY;
+    for (size_t o = 0; o < count; o++) {
+      float turn = cad_half_angle(out[o]) - angle;
+      if (turn <= 0.0f) turn += 2.0f*(float)M_PI;
+      if (turn < best_turn) {
+        best_turn = turn;
+        ccw = out[o];
+      }
+    }
+
+    /* if that's one of a few walls between the same posts, not into the
+     * sliver between two of them (where going along one comes right back) */
+    for (size_t o = 0; ccw != h && o < count; o++) {
+      uint32_t cw = *cad_half_next(cad_HALF_TWIN(ccw));
+      if (cw == ccw || *cad_half_next(cw) != cad_HALF_TWIN(ccw)) break;
+      ccw = cw;
+    }
+  }
+
+  /* on its own, coming back turns straight around */
+  if (ccw == h) {
+    *cad_half_next(cad_HALF_TWIN(h)) = h;
+    return h;
+  }
+  *cad_half_next(cad_HALF_TWIN(h)) = *cad_half_next(cad_HALF_TWIN(ccw));
+  *cad_half_next(cad_HALF_TWIN(ccw)) = h;
+  return cad_HALF_TWIN(ccw);
+}
+
+/* The reverse of cad_half_link: returns the half-edge that turned onto h
+ * and now turns onto what h's twin did, or h if h's post had no others. */
+static uint32_t cad_half_unlink(uint32_t h) {
+  uint32_t out[cad_POST_MAX_WALLS];
+  size_t count = cad_post_halves(cad_half_post(h), cad_HALF_WALL(h), out);
+
+  /* going by the links rather than angles, in case any are the same */
+  for (size_t o = 0; o < count; o++) {
+    uint32_t *next = cad_half_next(cad_HALF_TWIN(out[o]));
+    if (*next != h) continue;
+
+    *next = *cad_half_next(cad_HALF_TWIN(h));
+    return cad_HALF_TWIN(out[o]);
+  }
+  return h;
+}
+
+static void cad_room_drop(cad_RoomId room) {
+  uint32_t i = cad_pool_find(&cad.rooms, room.bits);
+  if (i) cad_pool_remove(&cad.rooms, i - 1);
+}
+
+/* makes a room of the half-edges around from h */
+static cad_RoomId cad_room_build(uint32_t h) {
+  cad_RoomId room = { cad_pool_add(&cad.rooms) };
+
+  float area = 0.0f;
+  Box2 bounds = BOX2_CLOSED;
+  uint32_t e = h;
+  for (uint32_t steps = 0;; steps++) {
+    if (steps > cad.walls.high*2) {
+      log_error("cad: half-edge %d doesn't come back around", h);
+      break;
+    }
+
+    f2 from = cad_post_pos(cad_half_post(e)), to = cad_post_pos(cad_half_post(cad_HALF_TWIN(e)));
+    area += from.x*to.y - to.x*from.y;
+    bounds.min.x = fminf(bounds.min.x, from.x);
+    bounds.min.y = fminf(bounds.min.y, from.y);
+    bounds.max.x = fmaxf(bounds.max.x, from.x);
+    bounds.max.y = fmaxf(bounds.max.y, from.y);
+    *cad_half_room(e) = room;
+
+    e = *cad_half_next(e);
+    if (e == h) break;
+  }
+
+  if (room.bits == 0) return room;
+  uint32_t i = cad_HANDLE_INDEX(room.bits);
+  cad_ROOM_CHUNK(i)->first [cad_SLOT(i)] = h;
+  cad_ROOM_CHUNK(i)->area  [cad_SLOT(i)] = area * 0.5f;
+  cad_ROOM_CHUNK(i)->bounds[cad_SLOT(i)] = bounds;
+  if (area > 0.0f) cad.room_reach = fmaxf(cad.room_reach, bounds.max.x);
+  return room;
+}
+
+/* Links (or unlinks) the wall into the half-edge graph, and redoes the
+ * rooms on either side of it: adding a wall either splits a room in two or
+ * joins two edges into one room, and removing one does the opposite. */
+static void cad_room_link(uint32_t wall, bool link) {
+  uint32_t h = wall*2, t = h + 1;
+  if (cad_half_post(h).bits == cad_half_post(t).bits) return;
+
+  /* loading redoes all of them at the end instead */
+  bool rooms = !cad.file.loading;
+
+  if (link) {
+    uint32_t before[2] = { cad_half_link(h), cad_half_link(t) };
+    if (!rooms) return;
+
+    /* whatever rooms it went into are gone */
+    for (int side = 0; side < 2; side++)
+      if (before[side] != h + side) cad_room_drop(*cad_half_room(before[side]));
+
+    cad_RoomId room = cad_room_build(h);
+    if (cad_half_room(t)->bits != room.bits) cad_room_build(t);
+  } else {
+    if (rooms) {
+      cad_room_drop(*cad_half_room(h));
+      cad_room_drop(*cad_half_room(t));
+    }
+    uint32_t after[2] = { cad_half_unlink(h), cad_half_unlink(t) };
+    if (!rooms) return;
+
+    cad_RoomId room = {0};
+    for (int side = 0; side < 2; side++) {
+      if (after[side] == h + side) continue;
+      if (room.bits && cad_half_room(after[side])->bits == room.bits) continue;
+      room = cad_room_build(after[side]);
+    }
+  }
+}
+
+static void cad_rooms_rebuild(void) {
+  for (uint32_t i = 0; i < cad.rooms.high; i++)
+    if (cad_pool_at(&cad.rooms, i)) cad_pool_remove(&cad.rooms, i);
+
+  for (uint32_t i = 0; i < cad.walls.high; i++)
+    for (int side = 0; side < 2; side++)
+      cad_WALL_CHUNK(i)->room[cad_SLOT(i)][side] = (cad_RoomId) {0};
+
+  for (uint32_t i = 0; i < cad.walls.high; i++) {
+    if (!cad_pool_at(&cad.walls, i)) continue;
+    cad_WallChunk *chunk = cad_WALL_CHUNK(i);
+    if (chunk->a[cad_SLOT(i)].bits == chunk->b[cad_SLOT(i)].bits) continue;
+
+    for (int side = 0; side < 2; side++)
+      if (chunk->room[cad_SLOT(i)][side].bits == 0) cad_room_build(i*2 + side);
+  }
+}
+
+static bool cad_room_enclosed(cad_RoomId room) {
+  uint32_t i = cad_pool_find(&cad.rooms, room.bits);
+  return i-- && cad_ROOM_CHUNK(i)->area[cad_SLOT(i)] > 0.0f;
+}
+
+static UNUSED_FN float cad_room_area(cad_RoomId room) {
+  uint32_t i = cad_pool_find(&cad.rooms, room.bits);
+  if (i-- == 0) return 0.0f;
+  return fmaxf(cad_ROOM_CHUNK(i)->area[cad_SLOT(i)], 0.0f);
+}
+
+static UNUSED_FN void cad_wall_rooms(cad_WallId wall, cad_RoomId *left, cad_RoomId *right) {
+  *left = *right = (cad_RoomId) {0};
+  uint32_t i = cad_pool_find(&cad.walls, wall.bits);
+  if (i-- == 0) return;
+
+  if (cad_room_enclosed(*cad_half_room(i*2    ))) *left  = *cad_half_room(i*2    );
+  if (cad_room_enclosed(*cad_half_room(i*2 + 1))) *right = *cad_half_room(i*2 + 1);
+}
+
+/* Goes along the ray from p towards +x through the wall grid: p is inside
+ * every room whose edge the ray crosses an odd number of times. (A wall with
+ * the same room on both sides is crossed twice, so it doesn't count.) */
+static UNUSED_FN cad_RoomId cad_room_around(f2 p) {
+  struct { cad_RoomId room; bool inside; } found[cad_ROOM_MAX_NESTED];
+  size_t found_count = 0;
+
+  int32_t y = cad_grid_cell(p.y);
+  for (int32_t x = cad_grid_cell(p.x); x <= cad_grid_cell(cad.room_reach); x++)
+    for (uint32_t node = *cad_GRID_BUCKET(&cad.wall_grid, x, y); node;) {
+      cad_GridChunk *chunk = cad_GRID_NODE(&cad.wall_grid, node - 1);
+      uint32_t slot = cad_SLOT(node - 1);
+      node = chunk->next[slot];
+      if (chunk->cell_x[slot] != x || chunk->cell_y[slot] != y) continue;
+
+      cad_PostId a, b;
+      cad_wall_posts((cad_WallId) { chunk->item[slot] }, &a, &b);
+      f2 from = cad_post_pos(a), to = cad_post_pos(b);
+      if ((from.y > p.y) == (to.y > p.y)) continue;
+
+      /* it's filed under every cell it crosses, so only count the one it crosses the ray in */
+      float cross_x = from.x + (p.y - from.y)*(to.x - from.x)/(to.y - from.y);
+      if (cross_x <= p.x || cad_grid_cell(cross_x) != x) continue;
+
+      for (int side = 0; side < 2; side++) {
+        cad_RoomId room = *cad_half_room(cad_HANDLE_INDEX(chunk->item[slot])*2 + side);
+        if (!cad_room_enclosed(room)) continue;
+
+        size_t f = 0;
+        while (f < found_count && found[f].room.bits != room.bits) f++;
+        if (f == found_count) {
+          if (found_count == cad_ROOM_MAX_NESTED) {
+            log_warn("cad: more than %d rooms around (%f, %f)", cad_ROOM_MAX_NESTED, p.x, p.y);
+            continue;
+          }
+          found[found_count].room = room;
+          found[found_count++].inside = false;
+        }
+        found[f].inside = !found[f].inside;
+      }
+    }
+
+  /* rooms inside rooms are smaller than them */
+  cad_RoomId best = {0};
+  float best_area = INFINITY;
+  for (size_t f = 0; f < found_count; f++) {
+    if (!found[f].inside) continue;
+    float area = cad_room_area(found[f].room);
+    if (area < best_area) {
+      best_area = area;
+      best = found[f].room;
+    }
+  }
+  return best;
+}
+
+/* } MARK */
+
+/* MARK: queries { */
+
+static cad_PostId cad_nearest_post(f2 p, float radius) {
+  cad_PostId best = {0};
+  float best_dist = radius;
+
+  /* (other cells hashed to the same buckets get looked at too, harmlessly) */
+  for (int32_t x = cad_grid_cell(p.x - radius); x <= cad_grid_cell(p.x + radius); x++)
+    for (int32_t y = cad_grid_cell(p.y - radius); y <= cad_grid_cell(p.y + radius); y++)
+      for (uint32_t node = *cad_GRID_BUCKET(&cad.post_grid, x, y); node;) {
+        cad_GridChunk *chunk = cad_GRID_NODE(&cad.post_grid, node - 1);
+        uint32_t item = chunk->item[cad_SLOT(node - 1)];
+        node = chunk->next[cad_SLOT(node - 1)];
+
+        f2 q = cad_post_pos((cad_PostId) { item });
+        float dist = f2_length((f2) { q.x - p.x, q.y - p.y });
+        if (dist <= best_dist) {
+          best_dist = dist;
+          best.bits = item;
+        }
+      }
+  return best;
+}
+
+static size_t cad_walls_near(f2 p, float radius, cad_WallId *out, size_t max) {
+  size_t count = 0;
+  for (int32_t x = cad_grid_cell(p.x - radius); x <= cad_grid_cell(p.x + radius); x++)
+    for (int32_t y = cad_grid_cell(p.y - radius); y <= cad_grid_cell(p.y + radius); y++)
+      for (uint32_t node = *cad_GRID_BUCKET(&cad.wall_grid, x, y); node && count < max;) {
+        cad_GridChunk *chunk = cad_GRID_NODE(&cad.wall_grid, node - 1);
+        cad_WallId wall = { chunk->item[cad_SLOT(node - 1)] };
+        node = chunk->next[cad_SLOT(node - 1)];
+
+        /* long walls are filed in lots of cells */
+        bool seen = false;
+        for (size_t i = 0; i < count && !seen; i++) seen = out[i].bits == wall.bits;
+        if (seen) continue;
+
+        cad_PostId a, b;
+        cad_wall_posts(wall, &a, &b);
+        if (f2_segment_distance(p, cad_post_pos(a), cad_post_pos(b)) <= radius)
+          out[count++] = wall;
+      }
+  return count;
+}
+
+static cad_WallId cad_ray_wall(f3 origin, f3 dir, float *t_out) {
+  f2 from = { origin.x, origin.y }, to = { origin.x + dir.x, origin.y + dir.y };
+  cad_WallId best = {0};
+  float best_t = 1.0f;
+
+  cad_GridWalk walk = cad_grid_walk(from, to);
+  do {
+    int32_t x = walk.x, y = walk.y;
+    for (uint32_t node = *cad_GRID_BUCKET(&cad.wall_grid, x, y); node;) {
+      cad_GridChunk *chunk = cad_GRID_NODE(&cad.wall_grid, node - 1);
+      uint32_t slot = cad_SLOT(node - 1);
+      node = chunk->next[slot];
+      if (chunk->cell_x[slot] != x || chunk->cell_y[slot] != y) continue;
+
+      cad_PostId pa, pb;
+      cad_wall_posts((cad_WallId) { chunk->item[slot] }, &pa, &pb);
+      f2 a = cad_post_pos(pa), b = cad_post_pos(pb);
+
+      /* from + d*t = a + ab*u */
+      f2 d = { dir.x, dir.y }, ab = { b.x - a.x, b.y - a.y }, ao = { a.x - from.x, a.y - from.y };
+      float denom = d.x*ab.y - d.y*ab.x;
+      if (denom == 0) continue;
+      float t = (ao.x*ab.y - ao.y*ab.x) / denom;
+      float u = (ao.x*d.y  - ao.y*d.x ) / denom;
+      if (u < 0 || u > 1 || t < 0 || t > best_t) continue;
+
+      float z = origin.z + dir.z*t;
+      if (z < 0 || z > cad_WALL_HEIGHT) continue;
+
+      best_t = t;
+      best.bits = chunk->item[slot];
+    }
+
+    /* nothing in a later cell can be closer */
+    if (best.bits && best_t <= fminf(walk.t_max_x, walk.t_max_y)) break;
+  } while (cad_grid_walk_next(&walk));
+
+  if (best.bits && t_out) *t_out = best_t;
+  return best;
+}
+
+/* } MARK */
+
+#define cad_COLOR ((Color) { 200, 80, 20, 255 })
+#define cad_HOVER_COLOR ((Color) { 255, 200, 60, 255 })
+#define cad_BLOCKED_COLOR ((Color) { 200, 30, 30, 255 })
+/* how close the mouse needs to be to a post to build off of it */
+#define cad_SNAP_RADIUS 0.5f
+
+static void cad_draw_post(f2 p) {
   gl_geo_box3_outline(
-    (f3) {        p.x,        p.y, POST_HEIGHT },
-    (f3) { POST_THICK, POST_THICK, POST_HEIGHT },
+    (f3) {            p.x,            p.y, cad_POST_HEIGHT },
+    (f3) { cad_POST_THICK, cad_POST_THICK, cad_POST_HEIGHT },
     1.0f,
-    (Color) { 200, 80, 20, 255 }
+    cad_COLOR
   );
 }
 
+/* for what's being placed; what's been built is drawn by gl (see gl_State.cad_boxes) */
+static void cad_draw_wall(f2 a, f2 b, Color color) {
+  for (int i = 0; i < 2; i++) {
+    float z = i ? cad_WALL_HEIGHT : 0.0f;
+    gl_geo_line(
+      jeux_world_to_screen((f3) { a.x, a.y, z }),
+      jeux_world_to_screen((f3) { b.x, b.y, z }),
+      1.0f,
+      color
+    );
+  }
+}
+
+/* Whether a wall from a to b would cross one that's already there, or
+ * meet one anywhere but a post. from and to are the posts it would go
+ * between; either can be the zero handle, for a post not placed yet. */
+#define cad_CROSS_MAX_WALLS 256
+static bool cad_wall_crosses(cad_PostId from, cad_PostId to, f2 a, f2 b) {
+  f2 mid = { (a.x + b.x)*0.5f, (a.y + b.y)*0.5f };
+  float radius = f2_length((f2) { b.x - a.x, b.y - a.y })*0.5f + cad_WALL_THICK;
+
+  cad_WallId near[cad_CROSS_MAX_WALLS];
+  size_t near_count = cad_walls_near(mid, radius, near, cad_CROSS_MAX_WALLS);
+  for (size_t i = 0; i < near_count; i++) {
+    cad_PostId p, q;
+    cad_wall_posts(near[i], &p, &q);
+    f2 c = cad_post_pos(p), d = cad_post_pos(q);
+
+    bool p_shared = p.bits == from.bits || p.bits == to.bits;
+    bool q_shared = q.bits == from.bits || q.bits == to.bits;
+    /* between the same posts, it goes right alongside */
+    if (p_shared && q_shared) continue;
+    /* (walls on the same post always "hit" right at it) */
+    if (!p_shared && !q_shared && f2_line_hits_line(a, b, c, d, NULL)) return true;
+
+    /* ending against a wall, or going over the end of one */
+    bool a_shared = from.bits && (from.bits == p.bits || from.bits == q.bits);
+    bool b_shared = to.bits   && (to.bits   == p.bits || to.bits   == q.bits);
+    if (!a_shared && f2_segment_distance(a, c, d) < cad_WALL_THICK) return true;
+    if (!b_shared && f2_segment_distance(b, c, d) < cad_WALL_THICK) return true;
+    if (!p_shared && f2_segment_distance(c, a, b) < cad_WALL_THICK) return true;
+    if (!q_shared && f2_segment_distance(d, a, b) < cad_WALL_THICK) return true;
+  }
+  return false;
+}
+
 static void cad_frame(void) {
-  if (cad.placing_wall) {
+  /* only the frame the button goes down counts as a click */
+  bool click = jeux.mouse_lmb_down && !cad.lmb_was_down;
+  cad.lmb_was_down = jeux.mouse_lmb_down;
 
-    cad_Post post = {0};
-    post.pos.x = jeux.mouse_ground.x;
-    post.pos.y = jeux.mouse_ground.y;
+  if (!cad.placing_wall) cad.input = cad_InputState_None;
+  else if (cad.input == cad_InputState_None) cad.input = cad_InputState_PlacingFirst;
 
-    if (jeux.mouse_lmb_down) {
-      cad.posts[cad.post_count++] = post;
-    } else {
-      cad_draw_wall(post);
-    }
+  /* the last post went away under us */
+  if (cad.input == cad_InputState_PlacingNext && !cad_post_alive(cad.placing_from))
+    cad.input = cad_InputState_PlacingFirst;
+
+  /* the wall under the mouse */
+  cad_WallId hovered;
+  {
+    f3 origin = jeux_screen_to_world((f3) { jeux.mouse_screen_x, jeux.mouse_screen_y,  1.0f });
+    f3 target = jeux_screen_to_world((f3) { jeux.mouse_screen_x, jeux.mouse_screen_y, -1.0f });
+    hovered = cad_ray_wall(origin, (f3) { target.x - origin.x, target.y - origin.y, target.z - origin.z }, NULL);
   }
 
-  for (int i = 0; i < cad.post_count; i++) {
-    cad_draw_wall(cad.posts[i]);
+  if (cad.input != cad_InputState_None) {
+    f2 mouse = { jeux.mouse_ground.x, jeux.mouse_ground.y };
+
+    /* build off of the post under the mouse, if there is one */
+    cad_PostId snap = cad_nearest_post(mouse, cad_SNAP_RADIUS);
+    if (snap.bits) mouse = cad_post_pos(snap);
+
+    /* a wall that would cross another isn't placed (nor is the post it'd end on) */
+    bool placing_wall = cad.input == cad_InputState_PlacingNext && snap.bits != cad.placing_from.bits;
+    bool blocked = placing_wall && cad_wall_crosses(cad.placing_from, snap, cad_post_pos(cad.placing_from), mouse);
+
+    if (click && !blocked) {
+      cad_PostId post = snap.bits ? snap : cad_post_add(mouse);
+      if (placing_wall && post.bits) cad_wall_add(cad.placing_from, post);
+
+      if (post.bits) {
+        cad.placing_from = post;
+        cad.input = cad_InputState_PlacingNext;
+      }
+    } else if (!click) {
+      cad_draw_post(mouse);
+      if (cad.input == cad_InputState_PlacingNext)
+        cad_draw_wall(cad_post_pos(cad.placing_from), mouse, blocked ? cad_BLOCKED_COLOR : cad_COLOR);
+    }
   }
+
+  jeux.gl.cad_boxes.count = cad_POST_BOX(cad.posts.high > cad.walls.high ? cad.posts.high : cad.walls.high);
+  jeux.gl.cad_boxes.hovered = hovered.bits ? (int)cad_WALL_BOX(cad_HANDLE_INDEX(hovered.bits)) : -1;
+  jeux.gl.cad_boxes.color = cad_COLOR;
+  jeux.gl.cad_boxes.hover_color = cad_HOVER_COLOR;
+
+  if (cad.file.pending_count > 0 && jeux.elapsed - cad.file.flushed_at >= cad_FILE_AUTOSAVE_SECONDS)
+    cad_file_flush();
 }
 
 #undef cad
@@ -0,0 +1,460 @@
+// vim: sw=2 ts=2 expandtab smartindent
+#ifndef character_IMPLEMENTATION
+
+/* Everyone animated: the player (always characters.all[0]) and any NPCs.
+ * Each frame every character's pose is evaluated, spread across the
+ * jobs workers, into one contiguous array of poses. */
+
+#define character_MAX 512
+
+/* Animation level of detail. Picked every frame for every character by
+ * how tall they are on screen; the smaller they are, the less often
+ * their pose gets sampled from the clips. */
+typedef enum {
+  character_Lod_Full,    /* sampled every frame */
+  character_Lod_Reduced, /* sampled character_LOD_REDUCED_HZ times a second, lerped in between */
+  character_Lod_Shared,  /* far away and just walking: borrows one of a few walk poses everyone shares */
+  character_Lod_Frozen,  /* off screen: the pose stays how it was */
+  character_Lod_COUNT
+} character_Lod;
+
+/* how many points in the walk cycle character_Lod_Shared has to pick from */
+#define character_LOD_SHARED_PHASES 8
+
+typedef struct {
+  f2 pos;
+
+  /* turning from one heading to another plays a turn animation */
+  float heading_from_rads, heading_to_rads;
+  double heading_from_ts, heading_to_ts;
+
+  /* seconds into the walk cycle at elapsed = 0, so crowds aren't in lockstep */
+  float walk_offset;
+
+  /* playback cursors for animdata_locate */
+  size_t walk_cursor, turn_cursor;
+
+  /* the LOD from the last frame, which of its poses needed sampling
+   * then, and whether the character has ever had a pose at all */
+  character_Lod lod;
+  bool sample_now, sample_to;
+  bool posed;
+
+  /* character_Lod_Reduced lerps the pose between these times */
+  double lod_from_ts, lod_to_ts;
+} character_Character;
+
+typedef struct {
+  character_Character all[character_MAX];
+  size_t count;
+
+  /* written by character_frame for every character
+   * (with jeux.gl.figure.gpu_anim, only the head's pose is) */
+  f4x4 model[character_MAX];
+  f3   poses[character_MAX][animdata_JointKey_COUNT];
+
+  /* the poses character_Lod_Reduced lerps between */
+  f3 lod_from[character_MAX][animdata_JointKey_COUNT];
+  f3 lod_to  [character_MAX][animdata_JointKey_COUNT];
+
+  /* the walk cycle at evenly spaced offsets, for character_Lod_Shared */
+  f3 shared_walk[character_LOD_SHARED_PHASES][animdata_JointKey_COUNT];
+  blend_Tree shared_trees[character_LOD_SHARED_PHASES];
+
+  /* this frame's poses that need sampling: for now, and for the end
+   * of a character_Lod_Reduced stretch. All of them go through the
+   * sampler, so characters that match up share clip samples. */
+  blend_Tree tree_now[character_MAX], tree_to[character_MAX];
+  blend_Sampler sampler;
+
+  /* last frame, per LOD: how many characters, and how many poses were asked for */
+  size_t lod_count[character_Lod_COUNT], lod_sampled[character_Lod_COUNT];
+
+  /* how many NPCs to surround the player with (a float for ui_slider) */
+  float debug_crowd;
+} character_State;
+
+static size_t character_spawn(f2 pos, float heading_rads);
+static void character_frame(void);
+#endif
+
+#ifdef character_IMPLEMENTATION
+
+/* characters per job; each one is a couple hundred floats of work */
+#define character_BATCH 16
+/* clip samples per job (see blend_sample) */
+#define character_SAMPLE_BATCH 32
+
+/* how tall a character has to be on screen (in window pixels) for each LOD */
+#define character_LOD_FULL_PX    150.0f
+#define character_LOD_REDUCED_PX  50.0f
+#define character_LOD_REDUCED_HZ  10.0
+
+/* in meters, tall enough to include the head */
+#define character_HEIGHT 1.9f
+
+static size_t character_spawn(f2 pos, float heading_rads) {
+  character_State *chars = &jeux.sim.characters;
+  if (chars->count == character_MAX) {
+    log_warn("can't spawn more than %d characters", character_MAX);
+    return character_MAX - 1;
+  }
+
+  size_t i = chars->count++;
+  chars->all[i] = (character_Character) {
+    .pos = pos,
+    .heading_from_rads = heading_rads,
+    .heading_to_rads   = heading_rads,
+  };
+  return i;
+}
+
+/* where a character is in their animations at a point in time */
+typedef struct {
+  f4x4 model;
+  animdata_ClipKey turn_clip;
+  float turn_anim_t, walk_anim_t;
+  /* 0 is all turn, 1 is all walk */
+  float return_anim_t;
+} character_Blend;
+
+static character_Blend character_blend(character_Character *c, double ts) {
+  character_Blend blend = {
+    .turn_clip = rads_distance(c->heading_from_rads, c->heading_to_rads) < 0
+      ? animdata_ClipKey_Turn90Left
+      : animdata_ClipKey_Turn90Right,
+  };
+  bool left = blend.turn_clip == animdata_ClipKey_Turn90Left;
+
+  animdata_Clip *turn_clip = animdata_clips[blend.turn_clip];
+  animdata_Clip *walk_clip = animdata_clips[animdata_ClipKey_Walk];
+
+  f4x4 model = f4x4_move((f3) { c->pos.x, c->pos.y, 0.0f });
+
+  /* here we figure out progress for the turn animation,
+   * and fade out either end of it via return_anim_t */
+  {
+    float turn_t = clamp(0, 1, inv_lerp(c->heading_from_ts, c->heading_to_ts, ts));
+
+    /* past the last key, it starts to wrap back around to the first one */
+    float loopless_duration = turn_clip->key_times[turn_clip->key_count - 1];
+    blend.turn_anim_t = turn_t * loopless_duration;
+    float turn_anim_begin_t  = clamp(0, 1, inv_lerp(loopless_duration*0.3,                 0, blend.turn_anim_t));
+    float turn_anim_finish_t = clamp(0, 1, inv_lerp(loopless_duration*0.7, loopless_duration, blend.turn_anim_t));
+    blend.return_anim_t = fmaxf(turn_anim_begin_t, turn_anim_finish_t);
+    float return_t = clamp(0, 1, blend.return_anim_t / loopless_duration);
+
+    model = f4x4_mul_affine(model, f4x4_turn(-rads_lerp(
+        c->heading_from_rads,
+        c->heading_to_rads,
+        turn_t
+    ) + M_PI*0.5f*turn_t*(left ? -1 : 1)*(1.0f - return_t) ));
+  }
+  blend.model = model;
+
+  blend.walk_anim_t = fmod(ts + c->walk_offset, (double)walk_clip->duration);
+  return blend;
+}
+
+/* the pose for blend, as a tree (cursors: whether to hand it the character's playback cursors) */
+static void character_tree(character_Character *c, character_Blend *blend, blend_Tree *tree, bool cursors) {
+  *tree = (blend_Tree) {0};
+  uint8_t turn = blend_clip(tree, blend->turn_clip,      blend->turn_anim_t, cursors ? &c->turn_cursor : NULL);
+  uint8_t walk = blend_clip(tree, animdata_ClipKey_Walk, blend->walk_anim_t, cursors ? &c->walk_cursor : NULL);
+  blend_cross_fade(tree, turn, walk, blend->return_anim_t);
+}
+
+/* picks a LOD by how tall the character is on screen */
+static character_Lod character_pick_lod(character_Character *c) {
+  f4 feet = f4x4_mul_f4(jeux.camera, (f4) { { c->pos.x, c->pos.y,              0.0f, 1.0f } });
+  f4 head = f4x4_mul_f4(jeux.camera, (f4) { { c->pos.x, c->pos.y, character_HEIGHT, 1.0f } });
+
+  /* entirely behind the camera, or too close to it to measure */
+  if (feet.p.w <= 0 && head.p.w <= 0) return character_Lod_Frozen;
+  if (feet.p.w <= 0 || head.p.w <= 0) return character_Lod_Full;
+
+  /* in window pixels, from the middle of the window */
+  float half_x = jeux.win_size_x * 0.5f, half_y = jeux.win_size_y * 0.5f;
+  f2 a = { feet.p.x / feet.p.w * half_x, feet.p.y / feet.p.w * half_y };
+  f2 b = { head.p.x / head.p.w * half_x, head.p.y / head.p.w * half_y };
+  float tall = f2_length((f2) { b.x - a.x, b.y - a.y });
+
+  /* arms out, they're about as wide as they are tall */
+  float reach = tall * 0.5f;
+  if (fmaxf(a.x, b.x) + reach < -half_x || fminf(a.x, b.x) - reach > half_x ||
+      fmaxf(a.y, b.y) + reach < -half_y || fminf(a.y, b.y) - reach > half_y)
+    return character_Lod_Frozen;
+
+  if (tall >= character_LOD_FULL_PX   ) return character_Lod_Full;
+  if (tall >= character_LOD_REDUCED_PX) return character_Lod_Reduced;
+  return character_Lod_Shared;
+}
+
+/* model matrices, LODs, and which poses need sampling for characters [begin, end);
+ * runs on the jobs workers */
+static void character_plan(void *data, size_t begin, size_t end) {
+  character_State *chars = data;
+  double elapsed = jeux.elapsed;
+
+  for (size_t i = begin; i < end; i++) {
+    character_Character *c = chars->all + i;
+
+    character_Blend blend = character_blend(c, elapsed);
+    chars->model[i] = blend.model;
+    c->sample_now = c->sample_to = false;
+
+    /* the GPU does the rest of the joints itself, we only need the head for its model */
+    if (jeux.gl.figure.gpu_anim) {
+      animdata_Clip *turn_clip = animdata_clips[blend.turn_clip];
+      animdata_Clip *walk_clip = animdata_clips[animdata_ClipKey_Walk];
+      animdata_Key walk_key = animdata_locate(walk_clip, blend.walk_anim_t, &c->walk_cursor);
+      animdata_Key turn_key = animdata_locate(turn_clip, blend.turn_anim_t, &c->turn_cursor);
+
+      f3 walk = animdata_sample_joint(walk_clip, walk_key, animdata_JointKey_Head);
+      f3 turn = animdata_sample_joint(turn_clip, turn_key, animdata_JointKey_Head);
+      chars->poses[i][animdata_JointKey_Head] = f3_lerp(turn, walk, blend.return_anim_t);
+
+      if (i < gl_figure_MAX) jeux.gl.figure.anims[i] = (gl_figure_Anim) {
+        .model  = blend.model,
+        .clip_a = blend.turn_clip,
+        .t_a    = blend.turn_anim_t,
+        .clip_b = animdata_ClipKey_Walk,
+        .t_b    = blend.walk_anim_t,
+        .weight = blend.return_anim_t,
+      };
+
+      /* none of that is sampling we could skip */
+      c->lod = character_Lod_Full;
+      c->posed = false;
+      continue;
+    }
+
+    /* the player always gets the full treatment */
+    character_Lod lod = (i == 0) ? character_Lod_Full : character_pick_lod(c);
+    /* only walking is shared, turns need their own */
+    if (lod == character_Lod_Shared && blend.return_anim_t < 1.0f) lod = character_Lod_Reduced;
+
+    switch (lod) {
+      case character_Lod_Full: c->sample_now = true; break;
+
+      case character_Lod_Reduced: {
+        if (c->lod == character_Lod_Reduced && elapsed < c->lod_to_ts) break;
+
+        /* start a new stretch, lerping on from wherever they are now */
+        c->sample_now = !c->posed;
+        c->sample_to = true;
+
+        /* a crowd walking into this LOD together shouldn't all sample on the same frames */
+        double period = 1.0 / character_LOD_REDUCED_HZ;
+        if (c->lod != character_Lod_Reduced) period *= (1 + i % 4) / 4.0;
+
+        c->lod_from_ts = elapsed;
+        c->lod_to_ts = elapsed + period;
+
+        /* no cursors; going back and forth between now and then would make them search */
+        character_Blend to = character_blend(c, c->lod_to_ts);
+        character_tree(c, &to, chars->tree_to + i, false);
+      } break;
+
+      case character_Lod_Shared: break;
+
+      /* it still needs something to be frozen in */
+      case character_Lod_Frozen: c->sample_now = !c->posed; break;
+
+      case character_Lod_COUNT: break;
+    }
+    if (c->sample_now) character_tree(c, &blend, chars->tree_now + i, true);
+
+    c->lod = lod;
+  }
+}
+
+/* poses for characters [begin, end), from what character_plan asked the sampler for;
+ * runs on the jobs workers */
+static void character_pose(void *data, size_t begin, size_t end) {
+  character_State *chars = data;
+  double elapsed = jeux.elapsed;
+  blend_Sampler *sampler = &chars->sampler;
+
+  if (jeux.gl.figure.gpu_anim) return;
+
+  for (size_t i = begin; i < end; i++) {
+    character_Character *c = chars->all + i;
+    f3 *pose = chars->poses[i];
+
+    if (c->sample_now) blend_evaluate(sampler, chars->tree_now + i, pose);
+
+    switch (c->lod) {
+      case character_Lod_Reduced: {
+        if (c->sample_to) {
+          SDL_memcpy(chars->lod_from[i], pose, sizeof(chars->lod_from[i]));
+          blend_evaluate(sampler, chars->tree_to + i, chars->lod_to[i]);
+        }
+
+        float t = clamp(0, 1, inv_lerp(c->lod_from_ts, c->lod_to_ts, elapsed));
+        animdata_pose_lerp(pose, chars->lod_from[i], chars->lod_to[i], t);
+      } break;
+
+      case character_Lod_Shared: {
+        float duration = animdata_clips[animdata_ClipKey_Walk]->duration;
+        size_t phase = (size_t)roundf(fmodf(c->walk_offset, duration) / duration * character_LOD_SHARED_PHASES);
+        SDL_memcpy(pose, chars->shared_walk[phase % character_LOD_SHARED_PHASES], sizeof(chars->poses[i]));
+      } break;
+
+      default: break;
+    }
+    c->posed = true;
+
+    /* nobody will see that it didn't move */
+    if (c->lod == character_Lod_Frozen && !c->sample_now) continue;
+
+    /* the figure renderer wants them in world space */
+    if (i < gl_figure_MAX) {
+      f4 *joints = jeux.gl.figure.joints[i];
+      f3 world[animdata_JointKey_COUNT];
+      f4x4_transform_f3_array(chars->model[i], pose, world, NULL, animdata_JointKey_COUNT);
+      for (int j = 0; j < animdata_JointKey_COUNT; j++)
+        joints[j] = (f4) { { world[j].x, world[j].y, world[j].z, 1.0f } };
+    }
+  }
+}
+
+/* the limbs are drawn by gl (see gl_State.figure), but the head is a model */
+static void character_draw_head(size_t i) {
+  character_State *chars = &jeux.sim.characters;
+  f3 head = chars->poses[i][animdata_JointKey_Head];
+
+  /* head assets are 2x2x2 centered around (0, 0, 0) */
+  float radius = 0.175f;
+
+  /* if this is 0.8f, a perfectly (0, 0, 1) aligned neck will penetrate 20% */
+  head.z += radius*0.8f;
+
+  f4x4 matrix = chars->model[i];
+  matrix = f4x4_mul_affine(matrix, f4x4_move(head));
+  /* the animations seem to be exported with the negative X axis as "forward," so ... */
+  matrix = f4x4_mul_affine(matrix, f4x4_turn(-M_PI * 0.5f));
+  matrix = f4x4_mul_affine(matrix, f4x4_scale(radius));
+
+  *jeux.gl.geo.model_draws_wtr++ = (gl_ModelDraw) { .model = gl_Model_Head, .matrix = matrix };
+  *jeux.gl.geo.model_draws_wtr++ = (gl_ModelDraw) { .model = gl_Model_HornedHelmet, .matrix = matrix };
+}
+
+/* the nth spot in square rings around the origin (n starts at 1, 0 is the middle) */
+static f2 character_crowd_spot(size_t n) {
+  int r = 1;
+  while (n > 8*r) n -= 8*r++;
+
+  int k = n - 1, side = 2*r, x, y;
+       if (k < 1*side) { x = -r + k         ; y = -r                ; }
+  else if (k < 2*side) { x =  r             ; y = -r + (k - 1*side) ; }
+  else if (k < 3*side) { x =  r - (k-2*side); y =  r                ; }
+  else                 { x = -r             ; y =  r - (k - 3*side) ; }
+
+  return (f2) { x, y };
+}
+
+/* keeps debug_crowd NPCs standing in rings around the player */
+static void character_debug_crowd(void) {
+  character_State *chars = &jeux.sim.characters;
+  size_t want = 1 + (size_t)chars->debug_crowd;
+  if (want > character_MAX) want = character_MAX;
+
+  if (chars->count > want) chars->count = want;
+  while (chars->count < want) {
+    size_t n = chars->count;
+
+    /* scattered, but the same every time */
+    float heading = lerp(-M_PI, M_PI, (float)((n * 2654435761u) % 1000) / 1000.0f);
+    size_t npc = character_spawn(character_crowd_spot(n), heading);
+    chars->all[npc].walk_offset = (float)((n * 40503u) % 1000) / 1000.0f;
+  }
+}
+
+static void character_frame(void) {
+  character_State *chars = &jeux.sim.characters;
+
+  character_debug_crowd();
+
+  jobs_parallel_for(chars->count, character_BATCH, character_plan, chars);
+
+  /* gather up every clip sample needed, sharing where they match */
+  if (!jeux.gl.figure.gpu_anim) {
+    blend_Sampler *sampler = &chars->sampler;
+    blend_sampler_reset(sampler);
+
+    /* the walk poses character_Lod_Shared picks from, the same for everyone this frame */
+    animdata_Clip *walk = animdata_clips[animdata_ClipKey_Walk];
+    for (size_t phase = 0; phase < character_LOD_SHARED_PHASES; phase++) {
+      float offset = walk->duration * phase / character_LOD_SHARED_PHASES;
+      float t = fmod(jeux.elapsed + offset, (double)walk->duration);
+
+      blend_Tree *tree = chars->shared_trees + phase;
+      *tree = (blend_Tree) {0};
+      blend_clip(tree, animdata_ClipKey_Walk, t, NULL);
+      blend_gather(sampler, tree);
+    }
+
+    for (size_t i = 0; i < chars->count; i++) {
+      character_Character *c = chars->all + i;
+      if (c->sample_now && !blend_gather(sampler, chars->tree_now + i)) c->sample_now = false;
+      if (c->sample_to  && !blend_gather(sampler, chars->tree_to  + i)) {
+        /* character_plan already moved the stretch on, but lod_from/lod_to are still
+         * the last one's; lerping those over the new times would pop, so hold still
+         * this frame and let the next one start the stretch over */
+        c->sample_to = false;
+        c->lod = character_Lod_Frozen;
+      }
+    }
+    if (sampler->count == blend_MAX_SAMPLES) log_warn("ran out of room to sample animations");
+
+    jobs_parallel_for(sampler->count, character_SAMPLE_BATCH, blend_sample, sampler);
+
+    for (size_t phase = 0; phase < character_LOD_SHARED_PHASES; phase++)
+      blend_evaluate(sampler, chars->shared_trees + phase, chars->shared_walk[phase]);
+  }
+
+  jobs_parallel_for(chars->count, character_BATCH, character_pose, chars);
+
+  /* tally up how much sampling the LODs saved */
+  for (int lod = 0; lod < character_Lod_COUNT; lod++) chars->lod_count[lod] = chars->lod_sampled[lod] = 0;
+  if (!jeux.gl.figure.gpu_anim) chars->lod_sampled[character_Lod_Shared] = character_LOD_SHARED_PHASES;
+  for (size_t i = 0; i < chars->count; i++) {
+    character_Character *c = chars->all + i;
+    chars->lod_count  [c->lod]++;
+    chars->lod_sampled[c->lod] += c->sample_now + c->sample_to;
+  }
+
+#if GAME_DEBUG
+  if (chars->count > 1 && !jeux.gl.figure.gpu_anim) {
+    static const char *names[character_Lod_COUNT] = { "full", "reduced", "shared", "frozen" };
+    for (int lod = 0; lod < character_Lod_COUNT; lod++) {
+      char line[128];
+      SDL_snprintf(line, sizeof(line), "%-8s %3d characters, %3d poses sampled",
+                   names[lod], (int)chars->lod_count[lod], (int)chars->lod_sampled[lod]);
+      gl_text_draw(line, 10.0f, 10.0f + 20.0f*lod, 16.0f);
+    }
+
+    /* and how much sharing (and leaving out clips with no weight) saved on top of that */
+    char line[128];
+    SDL_snprintf(line, sizeof(line), "%d clip samples needed, %d sampled",
+                 (int)chars->sampler.requested, (int)chars->sampler.count);
+    gl_text_draw(line, 10.0f, 10.0f + 20.0f*character_Lod_COUNT, 16.0f);
+  }
+#endif
+
+  /* every limb of every character is one instanced draw */
+  jeux.gl.figure.count = chars->count < gl_figure_MAX ? chars->count : gl_figure_MAX;
+  jeux.gl.figure.radius = jeux.win_size_x * 0.003f;
+  jeux.gl.figure.color = (Color) { 1, 1, 1, 255 };
+
+  /* the heads are two model draws each */
+  size_t heads_free = (jeux.gl.geo.model_draws + jx_COUNT(jeux.gl.geo.model_draws) - jeux.gl.geo.model_draws_wtr) / 2;
+  size_t heads = jeux.gl.figure.count < heads_free ? jeux.gl.figure.count : heads_free;
+  if (heads < chars->count)
+    log_warn("only room to draw %d of %d characters' heads", (int)heads, (int)chars->count);
+
+  for (size_t i = 0; i < heads; i++) character_draw_head(i);
+}
+
+#endif
@@ -17,6 +17,7 @@ typedef enum {
   gl_Model_Head,
   gl_Model_HornedHelmet,
 
+  /* everything from here down is a 2D UI asset, and gets batched (see gl_State.ui.batch) */
   gl_Model_UiOptions,
   gl_Model_UiArrowButton,
   gl_Model_UiCheck,
@@ -43,13 +44,110 @@ typedef struct { uint16_t a, b, c; } gl_Tri;
 
 typedef struct {
   gl_Model model;
-  /* just a model matrix, (view and projection get applied for you) */
+  /* just an affine model matrix, (view and projection get applied for you) */
   f4x4 matrix;
-  /* doesn't premultiply in camera matrix for you */
-  bool two_dee_ui;
-  Box2 scissor;
 } gl_ModelDraw;
 
+/* UI assets are 2D and don't need normals */
+typedef struct { f2 pos; Color color; } gl_ui_Vtx;
+
+/* one of these per UI asset/rectangle/border drawn, read by the UI batch's vertex shader.
+ * col0, col1 and col3 are the columns of the model matrix that matter for z=0 geometry. */
+typedef struct {
+  f4 col0, col1, col3;
+  Box2 clip;
+  /* gl_ui_Quad_Atlas: where in the atlas */
+  Box2 uv;
+  /* gl_ui_Quad_Fill/Border: radius per corner (top left, top right, bottom right, bottom left),
+   * border width per side (left, top, right, bottom), premultiplied color */
+  f4 radius, border, color;
+} gl_ui_Instance;
+
+/* The UI batch draws models, but also quads which are shaded entirely in the fragment shader */
+typedef enum {
+  gl_ui_Quad_Fill,   /* rounded rectangle     */
+  gl_ui_Quad_Border, /* rounded rectangle's outline */
+  gl_ui_Quad_Atlas,  /* rasterized UI asset   */
+  gl_ui_Quad_COUNT,
+} gl_ui_Quad;
+
+/* gl_ui_Vtx are stored in a texture this many texels wide (keep in sync with the shader) */
+#define gl_ui_VTX_TEX_SIZE_X 1024
+/* indices are (instance << 16) | vertex, and GLES 3.0 only promises
+ * GL_MAX_ELEMENT_INDEX >= 2^24 - 1, so this can't go past 256 */
+#define gl_ui_MAX_INSTANCES 256
+/* vertex indices at and above this are the corners of quads, 4 per gl_ui_Quad (keep in sync with the shader) */
+#define gl_ui_QUAD_VTX (0x10000 - 4*gl_ui_Quad_COUNT)
+
+/* stick figures: joints per figure and limbs per figure (keep in sync with the shader) */
+#define gl_figure_MAX 512
+#define gl_figure_MAX_JOINTS 16
+#define gl_figure_MAX_LIMBS 16
+#define gl_figure_MAX_CLIPS 8
+
+/* all the GPU needs to animate a figure itself (see gl_State.figure.gpu_anim) */
+typedef struct {
+  f4x4 model;
+  /* which clips (animdata_ClipKey, as floats), and seconds into each */
+  float clip_a, t_a, clip_b, t_b;
+  /* 0 is all clip a, 1 is all clip b */
+  float weight, _pad[3];
+} gl_figure_Anim;
+
+/* CAD boxes (see gl_State.cad_boxes); each row of tex_inst holds gl_cad_ROW of them
+ * (keep in sync with the shader) */
+#define gl_cad_MAX (1 << 17)
+#define gl_cad_ROW 256
+#define gl_cad_ROWS (gl_cad_MAX / gl_cad_ROW)
+
+/* a box from -thickness/2 to thickness/2 either side of the line from "from" to "to",
+ * and from z = 0 up to height; a height of 0 draws nothing */
+typedef struct {
+  f2 from, to;
+  float thickness, height, _pad[2];
+} gl_cad_Instance;
+
+/* a UI asset rasterized at a particular size, somewhere in the atlas */
+typedef struct {
+  gl_Model model;
+  /* the Clay image transform it was rasterized with */
+  uint64_t transform_hash;
+  /* in framebuffer pixels, x/y is where it is in the atlas */
+  int x, y, size_x, size_y;
+  /* the room it owns, padding included; can be bigger than size if it took
+   * over an evicted entry's spot */
+  int cell_x, cell_y;
+  /* gl_ui_Atlas.build it was last drawn in */
+  uint32_t last_used;
+} gl_ui_AtlasEntry;
+
+#define gl_ui_ATLAS_MAX_ENTRIES 64
+
+/* an entry gl_render still needs to draw into the atlas */
+typedef struct { gl_ui_AtlasEntry entry; f4x4 transform; } gl_ui_AtlasRaster;
+
+typedef struct {
+  GLuint tex, fb;
+  int size;
+
+  /* what the entries were rasterized for; if any of these change, we start over */
+  float gui_scale, pixel_density, fb_scale;
+  /* bumped every time the UI is rebuilt; when the atlas runs out of room, the
+   * least recently used entry not drawn in this build makes way */
+  uint32_t build;
+
+  gl_ui_AtlasEntry entries[gl_ui_ATLAS_MAX_ENTRIES];
+  size_t entry_count;
+
+  /* entries get packed left to right onto shelves, the bottom
+   * shelf being the only one we're still adding to */
+  int shelf_x, shelf_y, shelf_size_y;
+
+  /* entries allocated this frame that gl_render still needs to draw into the atlas */
+  gl_ui_AtlasRaster raster[gl_ui_ATLAS_MAX_ENTRIES];
+  size_t raster_count;
+} gl_ui_Atlas;
+
 typedef struct {
   gl_geo_Vtx vtx[99999];
   gl_geo_Vtx *vtx_wtr;
@@ -127,6 +225,120 @@ typedef struct {
     } screen;
   } pp;
 
+  /* The UI is retained: if the Clay render commands hash the same as they
+   * did last frame, gl_draw_clay_commands doesn't regenerate anything and
+   * gl_render doesn't reupload anything; last frame's buffers are reused. */
+  struct {
+    uint64_t hash;
+    /* false until the first UI has been generated */
+    bool valid;
+    /* true if the UI was regenerated this frame and needs uploading */
+    bool dirty;
+
+    /* All of the UI's assets (SVGs) are drawn in a single draw call.
+     *
+     * Every UI model's vertices live in one texture (tex_vtx), every asset
+     * drawn this frame writes its matrix and clip rect into another
+     * (tex_inst), and the index buffer stitches them together: each index
+     * is (instance << 16) | vertex. The vertex shader pulls both out of
+     * the textures using gl_VertexID, so no vertex attributes are bound. */
+    struct {
+      /* where each UI model's vertices start in tex_vtx */
+      uint32_t base_vtx[gl_Model_COUNT];
+
+      gl_ui_Instance  inst[gl_ui_MAX_INSTANCES];
+      gl_ui_Instance *inst_wtr;
+
+      uint32_t  idx[3*29999];
+      uint32_t *idx_wtr;
+
+      GLuint tex_vtx, tex_inst;
+      GLuint buf_idx;
+
+      GLuint shader;
+      GLint shader_u_mvp;
+      GLint shader_u_tex_vtx;
+      GLint shader_u_tex_inst;
+      GLint shader_u_tex_atlas;
+    } batch;
+
+    /* Some UI assets are thousands of triangles, and with SSAA we'd be drawing them
+     * at 16x the pixels. So instead, the first time an asset is drawn at a given size
+     * it gets rasterized (at framebuffer resolution) into this atlas, and after that
+     * it's just a textured quad in the batch. Assets too big for the atlas (or that
+     * don't fit in it) get drawn as geometry, like before. */
+    gl_ui_Atlas atlas;
+
+    /* UI text lives at the front of the text buffers, anything
+     * else (e.g. debug text) gets written after it */
+    size_t text_vtx_count, text_idx_count;
+  } ui;
+
+  /* Every stick figure's limbs are drawn in a single instanced draw.
+   *
+   * Which joints each limb connects is the same for every figure, so it's
+   * uploaded once (from animdata_limb_connections) at init. Each frame, only
+   * the world space position of every figure's joints gets uploaded (into
+   * tex_joints, a row per figure). Each instance is a figure, each limb a quad
+   * the vertex shader lays out in screen space around the two joints it
+   * connects, and the fragment shader turns that quad into a shaded capsule,
+   * so the joints get their round caps for free. */
+  struct {
+    /* written by whoever is animating the figures, count included */
+    f4 joints[gl_figure_MAX][gl_figure_MAX_JOINTS];
+    size_t count;
+    /* capsule radius, in window pixels */
+    float radius;
+    Color color;
+
+    /* Or, the figures can be animated on the GPU instead: every clip's keys
+     * are uploaded once (into tex_clips, a row per clip joint, a column per
+     * key), and each frame only anims (into tex_anims, a row per figure) is
+     * uploaded instead of joints. The vertex shader finds the keys and blends
+     * the two clips itself. */
+    bool gpu_anim;
+    gl_figure_Anim anims[gl_figure_MAX];
+
+    size_t limb_count;
+    GLuint tex_joints, tex_clips, tex_anims;
+
+    GLuint shader;
+    GLint shader_u_mvp;
+    GLint shader_u_win_size;
+    GLint shader_u_radius;
+    GLint shader_u_color;
+    GLint shader_u_tex_joints;
+    GLint shader_u_limbs;
+    GLint shader_u_gpu_anim;
+    GLint shader_u_tex_clips;
+    GLint shader_u_tex_anims;
+    GLint shader_u_clips;
+  } figure;
+
+  /* Every CAD wall and post is a box, and they're all drawn in a single
+   * instanced draw. The boxes live on the GPU (in tex_inst, gl_cad_ROW to a row)
+   * across frames: whoever edits one changes it through gl_cad_set, which
+   * marks its row dirty, and only dirty rows get uploaded. A box nobody
+   * touched costs nothing but its share of the draw. */
+  struct {
+    gl_cad_Instance *inst; /* gl_cad_MAX of them */
+    uint64_t dirty[gl_cad_ROWS / 64];
+    /* how many of inst to draw, and which of them to highlight (or -1) */
+    size_t count;
+    int hovered;
+    Color color, hover_color;
+
+    GLuint tex_inst;
+
+    GLuint shader;
+    GLint shader_u_mvp;
+    GLint shader_u_tex_inst;
+    GLint shader_u_hovered;
+    GLint shader_u_light_dir;
+    GLint shader_u_color;
+    GLint shader_u_hover_color;
+  } cad_boxes;
+
   struct {
     gl_text_Vtx vtx[9999];
     gl_text_Vtx *vtx_wtr;
@@ -161,6 +373,10 @@ static void gl_set_antialiasing_approach(gl_AntiAliasingApproach aa);
 static void gl_geo_reset(void);
 static void gl_text_reset(void);
 
+static bool gl_model_is_ui(gl_Model model);
+
+static void gl_cad_set(size_t i, gl_cad_Instance inst);
+
 /* easy text drawing, for e.g. debug text! */
 static void gl_text_draw(const char *msg, float screen_x, float screen_y, float size);
 
@@ -183,10 +399,20 @@ static UNUSED_FN void gl_geo_arc(
   Color color
 );
 
+/* must be called before any other text is drawn this frame,
+ * the UI's text is retained at the front of the text buffer */
 static void gl_draw_clay_commands(Clay_RenderCommandArray *rcommands);
 
 /* MARK: generating geometry for geometric primitives { */
 
+/* Pass as detail to the curved primitives to have it picked from how big they
+ * are on screen: enough segments that none sags more than gl_geo_TOLERANCE_PX
+ * framebuffer pixels inside the true curve (so fb_scale and gui_scale count) */
+#define gl_geo_DETAIL_AUTO 0
+#define gl_geo_TOLERANCE_PX 0.25f
+#define gl_geo_DETAIL_MIN 3
+#define gl_geo_DETAIL_MAX 128
+
 static UNUSED_FN void gl_geo_box3_outline(f3 center, f3 scale, float thickness, Color color);
 static UNUSED_FN void gl_geo_circle(size_t detail, f3 center, float radius, Color color) ;
 
@@ -214,6 +440,9 @@ static UNUSED_FN void gl_geo_ring2(
   Color color
 );
 
+/* how many points the world space emitters transform at once */
+#define gl_geo_POINT_BATCH 64
+
 static UNUSED_FN void gl_geo_ring3(
   size_t detail,
   f3 center,
@@ -335,6 +564,322 @@ static SDL_AppResult gl_init(void) {
           "}\n"
       },
 
+      {
+        .dst = &jeux.gl.ui.batch.shader,
+        .debug_name = "ui_batch",
+        .vs =
+          "#version 300 es\n"
+          "uniform mat4 u_mvp;\n"
+          "uniform highp usampler2D u_tex_vtx;\n"
+          "uniform highp sampler2D u_tex_inst;\n"
+          "\n"
+          "out vec4 v_color;\n"
+          "out vec2 v_ui_pos;\n"
+          "out vec2 v_uv;\n"
+          "out vec2 v_local;\n"
+          "flat out vec4 v_clip;\n"
+          "flat out int v_quad;\n"
+          "flat out vec2 v_size;\n"
+          "flat out vec4 v_radius;\n"
+          "flat out vec4 v_border;\n"
+          "\n"
+          "void main() {\n"
+          "  int inst = gl_VertexID >> 16;\n"
+          "  int vtx  = gl_VertexID & 0xFFFF;\n"
+          "\n"
+          "  vec4 col0 = texelFetch(u_tex_inst, ivec2(0, inst), 0);\n"
+          "  vec4 col1 = texelFetch(u_tex_inst, ivec2(1, inst), 0);\n"
+          "  vec4 col3 = texelFetch(u_tex_inst, ivec2(2, inst), 0);\n"
+          "  v_clip    = texelFetch(u_tex_inst, ivec2(3, inst), 0);\n"
+          "\n"
+          /* gl_ui_QUAD_VTX */
+          "  int quad_vtx = 0x10000 - 4*3;\n"
+          "  v_quad = vtx >= quad_vtx ? (vtx - quad_vtx) / 4 : -1;\n"
+          "\n"
+          "  vec2 pos;\n"
+          "  if (v_quad >= 0) {\n"
+          "    int corner = (vtx - quad_vtx) % 4;\n"
+          "    pos = vec2(corner == 1 || corner == 2, corner >= 2);\n"
+          "\n"
+          "    vec4 uv  = texelFetch(u_tex_inst, ivec2(4, inst), 0);\n"
+          "    v_radius = texelFetch(u_tex_inst, ivec2(5, inst), 0);\n"
+          "    v_border = texelFetch(u_tex_inst, ivec2(6, inst), 0);\n"
+          "    v_color  = texelFetch(u_tex_inst, ivec2(7, inst), 0);\n"
+          "    v_uv = mix(uv.xy, uv.zw, pos);\n"
+          "\n"
+          /* quads are placed with a scale, so this is their size in UI units */
+          "    v_size = vec2(col0.x, col1.y);\n"
+          "    v_local = pos * v_size;\n"
+          "  } else {\n"
+          "    uvec3 raw = texelFetch(u_tex_vtx, ivec2(vtx % 1024, vtx / 1024), 0).xyz;\n"
+          "    pos = uintBitsToFloat(raw.xy);\n"
+          "    v_color = vec4((uvec4(raw.z) >> uvec4(0, 8, 16, 24)) & 0xFFu) / 255.0;\n"
+          "\n"
+          "    v_uv = v_local = v_size = vec2(0);\n"
+          "    v_radius = v_border = vec4(0);\n"
+          "  }\n"
+          "\n"
+          "  vec4 ui_pos = col0*pos.x + col1*pos.y + col3;\n"
+          "  v_ui_pos = ui_pos.xy;\n"
+          "  gl_Position = u_mvp * ui_pos;\n"
+          "}\n"
+        ,
+        .fs =
+          "#version 300 es\n"
+          "precision mediump float;\n"
+          "\n"
+          "in vec4 v_color;\n"
+          "in highp vec2 v_ui_pos;\n"
+          "in highp vec2 v_uv;\n"
+          "in highp vec2 v_local;\n"
+          "flat in highp vec4 v_clip;\n"
+          "flat in int v_quad;\n"
+          "flat in highp vec2 v_size;\n"
+          "flat in highp vec4 v_radius;\n"
+          "flat in highp vec4 v_border;\n"
+          "\n"
+          "uniform sampler2D u_tex_atlas;\n"
+          "\n"
+          "out vec4 frag_color;\n"
+          "\n"
+          /* signed distance to a box centered on the origin; y is down,
+           * r is per corner: top left, top right, bottom right, bottom left */
+          "highp float sd_round_box(highp vec2 p, highp vec2 half_size, highp vec4 r) {\n"
+          "  highp float cr = (p.x < 0.0) ? ((p.y < 0.0) ? r.x : r.w)\n"
+          "                               : ((p.y < 0.0) ? r.y : r.z);\n"
+          "  cr = min(cr, min(half_size.x, half_size.y));\n"
+          "  highp vec2 q = abs(p) - half_size + cr;\n"
+          "  return min(max(q.x, q.y), 0.0) + length(max(q, 0.0)) - cr;\n"
+          "}\n"
+          "\n"
+          "void main() {\n"
+          /* one pixel, in UI units (before anything can discard) */
+          "  highp float px = length(fwidth(v_local)) * 0.7071;\n"
+          "\n"
+          /* clip rect replaces glScissor, it's per-instance now */
+          "  if (any(lessThan(v_ui_pos, v_clip.xy)) || any(greaterThan(v_ui_pos, v_clip.zw))) discard;\n"
+          "  frag_color = v_color;\n"
+          "\n"
+          /* atlas is premultiplied, same as everything else */
+          "  if (v_quad == 2) frag_color = texture(u_tex_atlas, v_uv);\n"
+          "\n"
+          "  if (v_quad == 0 || v_quad == 1) {\n"
+          "    highp vec2 half_size = v_size * 0.5;\n"
+          "    highp vec2 p = v_local - half_size;\n"
+          "\n"
+          "    highp float d = sd_round_box(p, half_size, v_radius);\n"
+          "    float alpha = clamp(0.5 - d/max(px, 1e-5), 0.0, 1.0);\n"
+          "\n"
+          /* border is the outer box minus the inner one: inset by each side's width */
+          "    if (v_quad == 1) {\n"
+          "      highp vec2 inner_min = v_border.xy;\n"
+          "      highp vec2 inner_max = v_size - v_border.zw;\n"
+          "      highp vec2 inner_half = max((inner_max - inner_min) * 0.5, 0.0);\n"
+          "      highp vec4 inner_r = max(v_radius - max(v_border.xzzx, v_border.yyww), 0.0);\n"
+          "\n"
+          "      highp float inner_d = sd_round_box(v_local - (inner_min + inner_half), inner_half, inner_r);\n"
+          "      alpha *= clamp(0.5 + inner_d/max(px, 1e-5), 0.0, 1.0);\n"
+          "    }\n"
+          "\n"
+          "    frag_color = v_color * alpha;\n"
+          "  }\n"
+          "\n"
+          /* don't let the transparent parts of a quad write depth */
+          "  if (frag_color.a == 0.0) discard;\n"
+          "}\n"
+      },
+
+      {
+        .dst = &jeux.gl.cad_boxes.shader,
+        .debug_name = "cad",
+        .vs =
+          "#version 300 es\n"
+          "uniform mat4 u_mvp;\n"
+          "uniform highp sampler2D u_tex_inst;\n"
+          "uniform int u_hovered;\n"
+          "\n"
+          "out vec3 v_normal;\n"
+          "flat out float v_hovered;\n"
+          "\n"
+          /* each face of the box, and a direction along it */
+          "const vec3 normals[6] = vec3[6](\n"
+          "  vec3(1, 0, 0), vec3(-1, 0, 0), vec3(0, 1, 0), vec3(0, -1, 0), vec3(0, 0, 1), vec3(0, 0, -1)\n"
+          ");\n"
+          "const vec3 tangents[6] = vec3[6](\n"
+          "  vec3(0, 1, 0), vec3(0, -1, 0), vec3(0, 0, 1), vec3(0, 0, -1), vec3(1, 0, 0), vec3(-1, 0, 0)\n"
+          ");\n"
+          "\n"
+          "void main() {\n"
+          /* 6 vertices (2 triangles) a face, in -1 .. 1 on every axis */
+          "  int corners[6] = int[6](0, 1, 2, 2, 1, 3);\n"
+          "  int face = gl_VertexID / 6;\n"
+          "  int corner = corners[gl_VertexID % 6];\n"
+          "  vec3 n = normals[face], t = tangents[face];\n"
+          "  vec3 local = n + t*float((corner & 1)*2 - 1) + cross(n, t)*float((corner >> 1)*2 - 1);\n"
+          "\n"
+          /* gl_cad_ROW, two texels a gl_cad_Instance */
+          "  ivec2 texel = ivec2((gl_InstanceID % 256)*2, gl_InstanceID / 256);\n"
+          "  vec4 ends = texelFetch(u_tex_inst, texel, 0);\n"
+          "  vec2 size = texelFetch(u_tex_inst, texel + ivec2(1, 0), 0).xy;\n"
+          "\n"
+          "  vec2 along = ends.zw - ends.xy;\n"
+          "  v_hovered = float(gl_InstanceID == u_hovered);\n"
+          "  if (size.y <= 0.0 || dot(along, along) <= 0.0) {\n"
+          "    v_normal = vec3(0);\n"
+          "    gl_Position = vec4(0);\n"
+          "    return;\n"
+          "  }\n"
+          "\n"
+          "  float len = length(along);\n"
+          "  vec2 dir = along / len, perp = vec2(-dir.y, dir.x);\n"
+          "  vec2 xy = (ends.xy + ends.zw)*0.5 + dir*local.x*len*0.5 + perp*local.y*size.x*0.5;\n"
+          "  gl_Position = u_mvp * vec4(xy, (local.z*0.5 + 0.5)*size.y, 1.0);\n"
+          "  v_normal = vec3(dir*n.x + perp*n.y, n.z);\n"
+          "}\n"
+        ,
+        .fs =
+          "#version 300 es\n"
+          "precision mediump float;\n"
+          "\n"
+          "in vec3 v_normal;\n"
+          "flat in float v_hovered;\n"
+          "\n"
+          "uniform vec3 u_light_dir;\n"
+          "uniform vec4 u_color;\n"
+          "uniform vec4 u_hover_color;\n"
+          "\n"
+          "out vec4 frag_color;\n"
+          "\n"
+          /* the same ramp as the geo shader */
+          "void main() {\n"
+          "  vec4 color = mix(u_color, u_hover_color, v_hovered);\n"
+          "  float diffuse = max(dot(v_normal, u_light_dir), 0.0);\n"
+          "  float ramp = 0.0;\n"
+          "       if (diffuse > 0.923) ramp = 1.00;\n"
+          "  else if (diffuse > 0.477) ramp = 0.50;\n"
+          "  frag_color = vec4(color.xyz * mix(0.8, 1.6, ramp), color.a);\n"
+          "}\n"
+      },
+
+      {
+        .dst = &jeux.gl.figure.shader,
+        .debug_name = "figure",
+        .vs =
+          "#version 300 es\n"
+          "uniform mat4 u_mvp;\n"
+          "uniform vec2 u_win_size;\n"
+          "uniform float u_radius;\n"
+          "uniform highp sampler2D u_tex_joints;\n"
+          /* gl_figure_MAX_LIMBS */
+          "uniform ivec2 u_limbs[16];\n"
+          "\n"
+          "uniform bool u_gpu_anim;\n"
+          "uniform highp sampler2D u_tex_clips;\n"
+          "uniform highp sampler2D u_tex_anims;\n"
+          /* key count and duration of each clip (gl_figure_MAX_CLIPS) */
+          "uniform vec2 u_clips[8];\n"
+          "\n"
+          /* window pixels, x along the limb from its first joint, y across it */
+          "out vec2 v_local;\n"
+          "flat out float v_length;\n"
+          "\n"
+          /* animdata_locate and animdata_sample_pose, for one joint;
+           * every texel has its key's time in w */
+          "vec3 clip_joint(int clip, float t, int joint) {\n"
+          /* gl_figure_MAX_JOINTS */
+          "  int first_row = clip*16;\n"
+          "  int count = int(u_clips[clip].x);\n"
+          "\n"
+          "  int lo = 0, hi = count;\n"
+          "  while (hi - lo > 1) {\n"
+          "    int mid = (lo + hi) / 2;\n"
+          "    if (texelFetch(u_tex_clips, ivec2(mid, first_row), 0).w <= t) lo = mid;\n"
+          "    else                                                          hi = mid;\n"
+          "  }\n"
+          "\n"
+          /* the last key tweens back into the first one */
+          "  bool last = lo + 1 == count;\n"
+          "  vec4 lhs = texelFetch(u_tex_clips, ivec2(lo,               first_row + joint), 0);\n"
+          "  vec4 rhs = texelFetch(u_tex_clips, ivec2(last ? 0 : lo + 1, first_row + joint), 0);\n"
+          "  float rhs_t = last ? u_clips[clip].y : rhs.w;\n"
+          "  return mix(lhs.xyz, rhs.xyz, (t - lhs.w) / max(rhs_t - lhs.w, 1e-6));\n"
+          "}\n"
+          "\n"
+          "vec3 joint_pos(int joint) {\n"
+          "  if (!u_gpu_anim) return texelFetch(u_tex_joints, ivec2(joint, gl_InstanceID), 0).xyz;\n"
+          "\n"
+          "  mat4 model = mat4(\n"
+          "    texelFetch(u_tex_anims, ivec2(0, gl_InstanceID), 0),\n"
+          "    texelFetch(u_tex_anims, ivec2(1, gl_InstanceID), 0),\n"
+          "    texelFetch(u_tex_anims, ivec2(2, gl_InstanceID), 0),\n"
+          "    texelFetch(u_tex_anims, ivec2(3, gl_InstanceID), 0)\n"
+          "  );\n"
+          "  vec4 clips  = texelFetch(u_tex_anims, ivec2(4, gl_InstanceID), 0);\n"
+          "  float weight = texelFetch(u_tex_anims, ivec2(5, gl_InstanceID), 0).x;\n"
+          "\n"
+          "  vec3 a = clip_joint(int(clips.x), clips.y, joint);\n"
+          "  vec3 b = clip_joint(int(clips.z), clips.w, joint);\n"
+          "  return (model * vec4(mix(a, b, weight), 1.0)).xyz;\n"
+          "}\n"
+          "\n"
+          "void main() {\n"
+          "  ivec2 limb = u_limbs[gl_VertexID / 6];\n"
+          /* two triangles; bit 0 is which end, bit 1 which side */
+          "  int corners[6] = int[6](0, 1, 2, 2, 1, 3);\n"
+          "  int corner = corners[gl_VertexID % 6];\n"
+          "\n"
+          "  vec4 a = u_mvp * vec4(joint_pos(limb.x), 1.0);\n"
+          "  vec4 b = u_mvp * vec4(joint_pos(limb.y), 1.0);\n"
+          "\n"
+          "  v_local = vec2(0);\n"
+          "  v_length = 0.0;\n"
+          /* behind the camera; collapse it */
+          "  if (a.w <= 0.0 || b.w <= 0.0) { gl_Position = vec4(0); return; }\n"
+          "\n"
+          "  vec2 half_win = u_win_size * 0.5;\n"
+          "  vec2 pa = a.xy / a.w * half_win;\n"
+          "  vec2 pb = b.xy / b.w * half_win;\n"
+          "\n"
+          "  float len = length(pb - pa);\n"
+          "  vec2 dir = len > 0.0 ? (pb - pa) / len : vec2(1, 0);\n"
+          "  vec2 side = vec2(-dir.y, dir.x);\n"
+          "\n"
+          /* reach a radius (and a pixel to antialias) past either joint */
+          "  float reach = u_radius + 1.0;\n"
+          "  v_local.x = (corner & 1) == 0 ? -reach : len + reach;\n"
+          "  v_local.y = (corner & 2) == 0 ? -reach :       reach;\n"
+          "  v_length = len;\n"
+          "\n"
+          "  vec4 end = (corner & 1) == 0 ? a : b;\n"
+          "  vec2 p = pa + dir*v_local.x + side*v_local.y;\n"
+          "  gl_Position = vec4(p / half_win * end.w, end.z, end.w);\n"
+          "}\n"
+        ,
+        .fs =
+          "#version 300 es\n"
+          "precision mediump float;\n"
+          "\n"
+          "in highp vec2 v_local;\n"
+          "flat in highp float v_length;\n"
+          "\n"
+          /* shared with the vertex shader, so the precision has to match */
+          "uniform highp float u_radius;\n"
+          "uniform vec4 u_color;\n"
+          "\n"
+          "out vec4 frag_color;\n"
+          "\n"
+          "void main() {\n"
+          /* distance to the segment between the joints */
+          "  highp float d = length(vec2(v_local.x - clamp(v_local.x, 0.0, v_length), v_local.y));\n"
+          "  float alpha = clamp(u_radius + 0.5 - d, 0.0, 1.0);\n"
+          "  if (alpha == 0.0) discard;\n"
+          "\n"
+          /* lit head on, like a tube: a little darker toward the edges */
+          "  float facing = sqrt(max(1.0 - (d*d)/(u_radius*u_radius), 0.0));\n"
+          "  frag_color = vec4(u_color.rgb * mix(0.75, 1.0, facing), u_color.a) * u_color.a * alpha;\n"
+          "}\n"
+      },
+
 #define AA_VERTEX_SHADER \
           "#version 300 es\n" \
           "in vec4 a_pos;\n" \
@@ -525,8 +1070,8 @@ static SDL_AppResult gl_init(void) {
           if (log_length > 0) {
             char *log = SDL_malloc(log_length);
             glGetShaderInfoLog(shader, log_length, &log_length, log);
-            SDL_Log(
-              "\n\n%s %s compilation failed:\n\n%s\n",
+            log_error(
+              "%s %s compilation failed:\n\n%s",
               shaders[shader_index].debug_name,
               s_name,
               log
@@ -660,6 +1205,262 @@ static SDL_AppResult gl_init(void) {
       glBufferData(GL_ELEMENT_ARRAY_BUFFER, tri_count * sizeof(gl_Tri), tri, GL_STATIC_DRAW);
     }
 
+    /* UI batch - every UI model's verts go into one texture */
+    {
+      size_t vtx_count = 0;
+      for (size_t i = 0; i < gl_Model_COUNT; i++)
+        if (gl_model_is_ui(i)) vtx_count += gl_modeldata[i].vtx_count;
+
+      /* the rest of the 16 bits are the corners of quads */
+      if (vtx_count > gl_ui_QUAD_VTX) log_error("too many UI vertices (%d) to index!", (int)vtx_count);
+
+      /* pad out to a whole number of rows */
+      size_t size_x = gl_ui_VTX_TEX_SIZE_X;
+      size_t size_y = (vtx_count + size_x - 1) / size_x;
+      gl_ui_Vtx *vtx = SDL_calloc(size_x * size_y, sizeof(gl_ui_Vtx));
+
+      uint32_t base = 0;
+      for (size_t i = 0; i < gl_Model_COUNT; i++) {
+        if (!gl_model_is_ui(i)) continue;
+
+        jeux.gl.ui.batch.base_vtx[i] = base;
+        for (size_t vtx_i = 0; vtx_i < gl_modeldata[i].vtx_count; vtx_i++) {
+          gl_geo_Vtx *v = gl_modeldata[i].vtx + vtx_i;
+          vtx[base++] = (gl_ui_Vtx) { { v->pos.x, v->pos.y }, v->color };
+        }
+      }
+
+      glGenTextures(1, &jeux.gl.ui.batch.tex_vtx);
+      glBindTexture(GL_TEXTURE_2D, jeux.gl.ui.batch.tex_vtx);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+      glTexImage2D(
+        /* GLenum  target         */ GL_TEXTURE_2D,
+        /* GLint   level          */ 0,
+        /* GLint   internalFormat */ GL_RGB32UI,
+        /* GLsizei width          */ size_x,
+        /* GLsizei height         */ size_y,
+        /* GLint   border         */ 0,
+        /* GLenum  format         */ GL_RGB_INTEGER,
+        /* GLenum  type           */ GL_UNSIGNED_INT,
+        /* const void *data       */ vtx
+      );
+      SDL_free(vtx);
+
+      glGenTextures(1, &jeux.gl.ui.batch.tex_inst);
+      glBindTexture(GL_TEXTURE_2D, jeux.gl.ui.batch.tex_inst);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+      glTexImage2D(
+        /* GLenum  target         */ GL_TEXTURE_2D,
+        /* GLint   level          */ 0,
+        /* GLint   internalFormat */ GL_RGBA32F,
+        /* GLsizei width          */ sizeof(gl_ui_Instance) / sizeof(float[4]),
+        /* GLsizei height         */ gl_ui_MAX_INSTANCES,
+        /* GLint   border         */ 0,
+        /* GLenum  format         */ GL_RGBA,
+        /* GLenum  type           */ GL_FLOAT,
+        /* const void *data       */ 0
+      );
+
+      glGenBuffers(1, &jeux.gl.ui.batch.buf_idx);
+      glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, jeux.gl.ui.batch.buf_idx);
+      glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(jeux.gl.ui.batch.idx), NULL, GL_DYNAMIC_DRAW);
+
+      jeux.gl.ui.batch.shader_u_mvp       = glGetUniformLocation(jeux.gl.ui.batch.shader, "u_mvp");
+      jeux.gl.ui.batch.shader_u_tex_vtx   = glGetUniformLocation(jeux.gl.ui.batch.shader, "u_tex_vtx");
+      jeux.gl.ui.batch.shader_u_tex_inst  = glGetUniformLocation(jeux.gl.ui.batch.shader, "u_tex_inst");
+      jeux.gl.ui.batch.shader_u_tex_atlas = glGetUniformLocation(jeux.gl.ui.batch.shader, "u_tex_atlas");
+    }
+
+    /* CAD boxes - all zero (so, not drawn) until someone gl_cad_sets them */
+    {
+      jeux.gl.cad_boxes.inst = SDL_calloc(gl_cad_MAX, sizeof(gl_cad_Instance));
+      if (jeux.gl.cad_boxes.inst == NULL) {
+        log_error("couldn't allocate CAD instances");
+        return SDL_APP_FAILURE;
+      }
+      jeux.gl.cad_boxes.hovered = -1;
+
+      glGenTextures(1, &jeux.gl.cad_boxes.tex_inst);
+      glBindTexture(GL_TEXTURE_2D, jeux.gl.cad_boxes.tex_inst);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+      glTexImage2D(
+        /* GLenum  target         */ GL_TEXTURE_2D,
+        /* GLint   level          */ 0,
+        /* GLint   internalFormat */ GL_RGBA32F,
+        /* GLsizei width          */ gl_cad_ROW * sizeof(gl_cad_Instance) / sizeof(float[4]),
+        /* GLsizei height         */ gl_cad_ROWS,
+        /* GLint   border         */ 0,
+        /* GLenum  format         */ GL_RGBA,
+        /* GLenum  type           */ GL_FLOAT,
+        /* const void *data       */ jeux.gl.cad_boxes.inst
+      );
+
+      GLuint shader = jeux.gl.cad_boxes.shader;
+      jeux.gl.cad_boxes.shader_u_mvp         = glGetUniformLocation(shader, "u_mvp");
+      jeux.gl.cad_boxes.shader_u_tex_inst    = glGetUniformLocation(shader, "u_tex_inst");
+      jeux.gl.cad_boxes.shader_u_hovered     = glGetUniformLocation(shader, "u_hovered");
+      jeux.gl.cad_boxes.shader_u_light_dir   = glGetUniformLocation(shader, "u_light_dir");
+      jeux.gl.cad_boxes.shader_u_color       = glGetUniformLocation(shader, "u_color");
+      jeux.gl.cad_boxes.shader_u_hover_color = glGetUniformLocation(shader, "u_hover_color");
+    }
+
+    /* stick figures - joints get uploaded every frame, but limbs only here */
+    {
+      glGenTextures(1, &jeux.gl.figure.tex_joints);
+      glBindTexture(GL_TEXTURE_2D, jeux.gl.figure.tex_joints);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+      glTexImage2D(
+        /* GLenum  target         */ GL_TEXTURE_2D,
+        /* GLint   level          */ 0,
+        /* GLint   internalFormat */ GL_RGBA32F,
+        /* GLsizei width          */ gl_figure_MAX_JOINTS,
+        /* GLsizei height         */ gl_figure_MAX,
+        /* GLint   border         */ 0,
+        /* GLenum  format         */ GL_RGBA,
+        /* GLenum  type           */ GL_FLOAT,
+        /* const void *data       */ 0
+      );
+
+      GLuint shader = jeux.gl.figure.shader;
+      jeux.gl.figure.shader_u_mvp        = glGetUniformLocation(shader, "u_mvp");
+      jeux.gl.figure.shader_u_win_size   = glGetUniformLocation(shader, "u_win_size");
+      jeux.gl.figure.shader_u_radius     = glGetUniformLocation(shader, "u_radius");
+      jeux.gl.figure.shader_u_color      = glGetUniformLocation(shader, "u_color");
+      jeux.gl.figure.shader_u_tex_joints = glGetUniformLocation(shader, "u_tex_joints");
+      jeux.gl.figure.shader_u_limbs      = glGetUniformLocation(shader, "u_limbs");
+
+      size_t limb_count = jx_COUNT(animdata_limb_connections);
+      if (limb_count > gl_figure_MAX_LIMBS) {
+        log_error("too many limbs (%d) for the figure shader!", (int)limb_count);
+        limb_count = gl_figure_MAX_LIMBS;
+      }
+      if (animdata_JointKey_COUNT > gl_figure_MAX_JOINTS)
+        log_error("too many joints (%d) for the figure shader!", (int)animdata_JointKey_COUNT);
+
+      GLint limbs[gl_figure_MAX_LIMBS][2];
+      for (size_t i = 0; i < limb_count; i++) {
+        limbs[i][0] = animdata_limb_connections[i].from;
+        limbs[i][1] = animdata_limb_connections[i].to;
+      }
+      glUseProgram(shader);
+      glUniform2iv(jeux.gl.figure.shader_u_limbs, limb_count, limbs[0]);
+      jeux.gl.figure.limb_count = limb_count;
+
+      /* for gpu_anim: every clip, fully decoded, and one row of figures' anims per figure */
+      {
+        jeux.gl.figure.shader_u_gpu_anim   = glGetUniformLocation(shader, "u_gpu_anim");
+        jeux.gl.figure.shader_u_tex_clips  = glGetUniformLocation(shader, "u_tex_clips");
+        jeux.gl.figure.shader_u_tex_anims  = glGetUniformLocation(shader, "u_tex_anims");
+        jeux.gl.figure.shader_u_clips      = glGetUniformLocation(shader, "u_clips");
+
+        size_t clip_count = animdata_ClipKey_COUNT;
+        if (clip_count > gl_figure_MAX_CLIPS) {
+          log_error("too many clips (%d) for the figure shader!", (int)clip_count);
+          clip_count = gl_figure_MAX_CLIPS;
+        }
+
+        size_t size_x = 1;
+        for (size_t clip_i = 0; clip_i < clip_count; clip_i++)
+          if (animdata_clips[clip_i]->key_count > size_x) size_x = animdata_clips[clip_i]->key_count;
+        size_t size_y = gl_figure_MAX_CLIPS * gl_figure_MAX_JOINTS;
+
+        f4 *texels = SDL_calloc(size_x * size_y, sizeof(f4));
+        GLfloat clips[gl_figure_MAX_CLIPS][2] = {0};
+        for (size_t clip_i = 0; clip_i < clip_count; clip_i++) {
+          animdata_Clip *clip = animdata_clips[clip_i];
+          clips[clip_i][0] = clip->key_count;
+          clips[clip_i][1] = clip->duration;
+
+          for (size_t key_i = 0; key_i < clip->key_count; key_i++) {
+            f3 pose[animdata_JointKey_COUNT];
+            animdata_sample_pose(clip, (animdata_Key) { .lhs = key_i, .rhs = key_i }, pose);
+
+            for (size_t joint = 0; joint < animdata_JointKey_COUNT && joint < gl_figure_MAX_JOINTS; joint++) {
+              f3 p = pose[joint];
+              size_t row = clip_i*gl_figure_MAX_JOINTS + joint;
+              texels[row*size_x + key_i] = (f4) { { p.x, p.y, p.z, clip->key_times[key_i] } };
+            }
+          }
+        }
+
+        glGenTextures(1, &jeux.gl.figure.tex_clips);
+        glBindTexture(GL_TEXTURE_2D, jeux.gl.figure.tex_clips);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexImage2D(
+          /* GLenum  target         */ GL_TEXTURE_2D,
+          /* GLint   level          */ 0,
+          /* GLint   internalFormat */ GL_RGBA32F,
+          /* GLsizei width          */ size_x,
+          /* GLsizei height         */ size_y,
+          /* GLint   border         */ 0,
+          /* GLenum  format         */ GL_RGBA,
+          /* GLenum  type           */ GL_FLOAT,
+          /* const void *data       */ texels
+        );
+        SDL_free(texels);
+
+        glUniform2fv(jeux.gl.figure.shader_u_clips, gl_figure_MAX_CLIPS, clips[0]);
+
+        glGenTextures(1, &jeux.gl.figure.tex_anims);
+        glBindTexture(GL_TEXTURE_2D, jeux.gl.figure.tex_anims);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexImage2D(
+          /* GLenum  target         */ GL_TEXTURE_2D,
+          /* GLint   level          */ 0,
+          /* GLint   internalFormat */ GL_RGBA32F,
+          /* GLsizei width          */ sizeof(gl_figure_Anim) / sizeof(float[4]),
+          /* GLsizei height         */ gl_figure_MAX,
+          /* GLint   border         */ 0,
+          /* GLenum  format         */ GL_RGBA,
+          /* GLenum  type           */ GL_FLOAT,
+          /* const void *data       */ 0
+        );
+      }
+    }
+
+    /* UI atlas - UI models get rasterized into this from their static buffers */
+    {
+      GLint max_size;
+      glGetIntegerv(GL_MAX_TEXTURE_SIZE, &max_size);
+      jeux.gl.ui.atlas.size = max_size < 4096 ? max_size : 4096;
+
+      glGenTextures(1, &jeux.gl.ui.atlas.tex);
+      glBindTexture(GL_TEXTURE_2D, jeux.gl.ui.atlas.tex);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+      glTexImage2D(
+        /* GLenum  target         */ GL_TEXTURE_2D,
+        /* GLint   level          */ 0,
+        /* GLint   internalFormat */ GL_RGBA,
+        /* GLsizei width          */ jeux.gl.ui.atlas.size,
+        /* GLsizei height         */ jeux.gl.ui.atlas.size,
+        /* GLint   border         */ 0,
+        /* GLenum  format         */ GL_RGBA,
+        /* GLenum  type           */ GL_UNSIGNED_BYTE,
+        /* const void *data       */ 0
+      );
+
+      glGenFramebuffers(1, &jeux.gl.ui.atlas.fb);
+      glBindFramebuffer(GL_FRAMEBUFFER, jeux.gl.ui.atlas.fb);
+      glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, jeux.gl.ui.atlas.tex, 0);
+
+      GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+      if (status != GL_FRAMEBUFFER_COMPLETE) {
+        log_error("couldn't make UI atlas framebuffer: %x", status);
+        /* nothing will fit, everything gets drawn as geometry */
+        jeux.gl.ui.atlas.size = 0;
+      }
+      glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    }
+
     /* shader data layout */
     jeux.gl.geo.shader_u_mvp       = glGetUniformLocation(jeux.gl.geo.shader, "u_mvp");
     jeux.gl.geo.shader_u_light_dir = glGetUniformLocation(jeux.gl.geo.shader, "u_light_dir");
@@ -871,14 +1672,15 @@ static void gl_resize(void) {
 
     GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
     if (status != GL_FRAMEBUFFER_COMPLETE) {
-      SDL_Log("couldn't make render buffer: %x", status);
+      log_error("couldn't make render buffer: %x", status);
     }
   }
 }
 
 static void gl_text_reset(void) {
-  jeux.gl.text.vtx_wtr = jeux.gl.text.vtx;
-  jeux.gl.text.idx_wtr = jeux.gl.text.idx;
+  /* keep whatever the UI retained */
+  jeux.gl.text.vtx_wtr = jeux.gl.text.vtx + jeux.gl.ui.text_vtx_count;
+  jeux.gl.text.idx_wtr = jeux.gl.text.idx + jeux.gl.ui.text_idx_count;
 }
 
 /* easy text drawing, for e.g. debug text! */
@@ -997,12 +1799,47 @@ static void gl_text_draw_ex(
   jeux.gl.text.idx_wtr = idx_wtr;
 }
 
+static bool gl_model_is_ui(gl_Model model) {
+  return model >= gl_Model_UiOptions;
+}
+
+/* dyn_geo_ui is left alone; it's retained across frames and
+ * gl_draw_clay_commands resets it when the UI actually changes */
 static void gl_geo_reset(void) {
-  jeux.gl.geo.dyn_geo_ui   .vtx_wtr = jeux.gl.geo.dyn_geo_ui   .vtx;
-  jeux.gl.geo.dyn_geo_ui   .idx_wtr = jeux.gl.geo.dyn_geo_ui   .idx;
   jeux.gl.geo.dyn_geo_world.vtx_wtr = jeux.gl.geo.dyn_geo_world.vtx;
   jeux.gl.geo.dyn_geo_world.idx_wtr = jeux.gl.geo.dyn_geo_world.idx;
   jeux.gl.geo.model_draws_wtr = jeux.gl.geo.model_draws;
+  jeux.gl.figure.count = 0;
+}
+
+/* framebuffer pixels per unit of whatever gl_geo_* is drawing in right now */
+static float gl_geo_px_per_unit(void) {
+  float px = jeux.gl.pp.fb_scale;
+  if (jeux.win_size_x > 0) px *= jeux.gl.pp.phys_win_size_x / (float)jeux.win_size_x;
+  if (jeux.gl.geo.dyn == &jeux.gl.geo.dyn_geo_ui) px *= jeux.gui_scale;
+  return px;
+}
+
+/* detail, unless it's gl_geo_DETAIL_AUTO */
+static size_t gl_geo_detail(size_t detail, float radius_px, float radians) {
+  if (detail != gl_geo_DETAIL_AUTO) return detail;
+
+  /* a segment spanning 2a radians sags radius*(1 - cos(a)) in the middle */
+  float n = gl_geo_DETAIL_MAX;
+  if (radius_px <= gl_geo_TOLERANCE_PX)
+    n = gl_geo_DETAIL_MIN;
+  else {
+    float half_step = acosf(1.0f - gl_geo_TOLERANCE_PX / radius_px);
+    if (half_step > 0.0f) n = ceilf(fabsf(radians) / (2.0f * half_step));
+  }
+  return (size_t)clamp(gl_geo_DETAIL_MIN, gl_geo_DETAIL_MAX, n);
+}
+
+static void gl_cad_set(size_t i, gl_cad_Instance inst) {
+  if (i >= gl_cad_MAX) return;
+  jeux.gl.cad_boxes.inst[i] = inst;
+  size_t row = i / gl_cad_ROW;
+  jeux.gl.cad_boxes.dirty[row / 64] |= 1ull << (row % 64);
 }
 
 static UNUSED_FN void gl_geo_arc(
@@ -1015,13 +1852,15 @@ static UNUSED_FN void gl_geo_arc(
 ) {
   uint16_t start = jeux.gl.geo.dyn->vtx_wtr - jeux.gl.geo.dyn->vtx;
 
+  detail = gl_geo_detail(detail, radius * gl_geo_px_per_unit(), radians_to - radians_from);
+
   /* center of the triangle fan */
   *jeux.gl.geo.dyn->vtx_wtr++ = (gl_geo_Vtx) { .pos = center, .color = color };
 
-  for (int i = 0; i <= detail; i++) {
-    float t = lerp(radians_from, radians_to, (float)i / (float)detail);
-    float x = center.x + cosf(t) * radius;
-    float y = center.y + sinf(t) * radius;
+  math_ArcWalk walk = math_arc_walk(radians_from, radians_to, detail);
+  for (int i = 0; i <= detail; i++, math_arc_step(&walk)) {
+    float x = center.x + walk.p.x * radius;
+    float y = center.y + walk.p.y * radius;
     *jeux.gl.geo.dyn->vtx_wtr++ = (gl_geo_Vtx) { { x, y, center.z }, color };
 
     if (i > 0) *jeux.gl.geo.dyn->idx_wtr++ = (gl_Tri) { start, start + i, start + i + 1 };
@@ -1090,21 +1929,15 @@ static UNUSED_FN void gl_geo_ring2_arc(
   float thickness,
   Color color
 ) {
+  detail = gl_geo_detail(detail, radius * gl_geo_px_per_unit(), radians_to - radians_from);
+
+  math_ArcWalk walk = math_arc_walk(radians_from, radians_to, detail);
+  f3 last = { center.x + walk.p.x * radius, center.y + walk.p.y * radius, center.z };
   for (int i = 0; i < detail; i++) {
-    float t0 = lerp(radians_from, radians_to, (float)i / (float)detail);
-    float x0 = center.x + cosf(t0) * radius;
-    float y0 = center.y + sinf(t0) * radius;
-
-    float t1 = lerp(radians_from, radians_to, (float)(i + 1) / (float)detail);
-    float x1 = center.x + cosf(t1) * radius;
-    float y1 = center.y + sinf(t1) * radius;
-
-    gl_geo_line(
-      (f3) { x0, y0, center.z },
-      (f3) { x1, y1, center.z },
-      thickness,
-      color
-    );
+    math_arc_step(&walk);
+    f3 next = { center.x + walk.p.x * radius, center.y + walk.p.y * radius, center.z };
+    gl_geo_line(last, next, thickness, color);
+    last = next;
   }
 }
 
@@ -1133,70 +1966,349 @@ static UNUSED_FN void gl_geo_ring3(
   float thickness,
   Color color
 ) {
-  for (int i = 0; i < detail; i++) {
-    float t0 = (float)i / (float)detail * M_PI * 2.0f;
-    float x0 = center.x + cosf(t0) * radius;
-    float y0 = center.y + sinf(t0) * radius;
-
-    float t1 = (float)(i + 1) / (float)detail * M_PI * 2.0f;
-    float x1 = center.x + cosf(t1) * radius;
-    float y1 = center.y + sinf(t1) * radius;
-
-    gl_geo_line(
-      jeux_world_to_screen((f3) { x0, y0, center.z }),
-      jeux_world_to_screen((f3) { x1, y1, center.z }),
-      thickness,
-      color
-    );
+  if (detail == gl_geo_DETAIL_AUTO) {
+    /* the ring's biggest it looks on screen is along one of its axes */
+    f3 c  = jeux_world_to_screen(center);
+    f3 px = jeux_world_to_screen((f3) { center.x + radius, center.y, center.z });
+    f3 py = jeux_world_to_screen((f3) { center.x, center.y + radius, center.z });
+    float radius_screen = fmaxf(f2_length((f2) { px.x - c.x, px.y - c.y }),
+                                f2_length((f2) { py.x - c.x, py.y - c.y }));
+    detail = gl_geo_detail(detail, radius_screen * gl_geo_px_per_unit(), M_PI * 2.0f);
+  }
+
+  f4x4 mvp = f4x4_mul_affine(jeux.camera, f4x4_move(center));
+  math_ArcWalk walk = math_arc_walk(0.0f, M_PI * 2.0f, detail);
+
+  /* in batches, each starting on the last one's final point */
+  f2 ring[gl_geo_POINT_BATCH];
+  f3 screen[gl_geo_POINT_BATCH];
+  uint8_t outside[gl_geo_POINT_BATCH];
+  for (size_t begin = 0; begin < detail; begin += gl_geo_POINT_BATCH - 1) {
+    size_t count = detail + 1 - begin;
+    if (count > gl_geo_POINT_BATCH) count = gl_geo_POINT_BATCH;
+
+    /* (the first point was the last batch's last one) */
+    ring[0] = (f2) { walk.p.x * radius, walk.p.y * radius };
+    for (size_t i = 1; i < count; i++) {
+      math_arc_step(&walk);
+      ring[i] = (f2) { walk.p.x * radius, walk.p.y * radius };
+    }
+    f4x4_transform_f2_array(mvp, ring, screen, outside, count);
+    jeux_clip_to_screen_array(screen, count);
+
+    for (size_t i = 0; i + 1 < count; i++) {
+      if (outside[i] & outside[i + 1]) continue;
+      gl_geo_line(screen[i], screen[i + 1], thickness, color);
+    }
   }
 }
 
 static UNUSED_FN void gl_geo_box3_outline(f3 center, f3 scale, float thickness, Color color) {
+  /* corner i is on the positive side of x if bit 0 is set, y for bit 1, z for bit 2 */
+  f3 corners[8];
+  uint8_t outside[8];
+  for (int i = 0; i < 8; i++)
+    corners[i] = (f3) {
+      center.x + ((i & 1) ? scale.x : -scale.x),
+      center.y + ((i & 2) ? scale.y : -scale.y),
+      center.z + ((i & 4) ? scale.z : -scale.z),
+    };
+  f4x4_transform_f3_array(jeux.camera, corners, corners, outside, 8);
+  jeux_clip_to_screen_array(corners, 8);
+
+  /* an edge for every pair of corners one bit apart */
+  for (int i = 0; i < 8; i++)
+    for (int bit = 1; bit < 8; bit <<= 1) {
+      if (i & bit) continue;
+      if (outside[i] & outside[i | bit]) continue;
+      gl_geo_line(corners[i], corners[i | bit], thickness, color);
+    }
+}
 
-  for (float dir_x = 0; dir_x < 2; dir_x++) {
-    for (float dir_y = -1; dir_y <= 1; dir_y += 2) {
-      for (int axis_i = 0; axis_i < 3; axis_i++) {
-        f4 a = {0}, b = {0};
-        a.arr[axis_i] = -1;
-        b.arr[axis_i] =  1;
-
-        for (int i = 0; i < 3; i++) {
-          if (i == axis_i) continue;
-          a.arr[i] = dir_y;
-          b.arr[i] = dir_y;
-        }
-        if (dir_x) a.arr[(axis_i+1)%3] *= -1;
-        if (dir_x) b.arr[(axis_i+1)%3] *= -1;
+/* FNV-1a, used to tell if the UI changed since last frame */
+static uint64_t gl_hash_bytes(uint64_t hash, const void *bytes, size_t len) {
+  const uint8_t *b = bytes;
+  for (size_t i = 0; i < len; i++) {
+    hash ^= b[i];
+    hash *= 0x100000001b3ull;
+  }
+  return hash;
+}
+#define gl_HASH(hash, x) gl_hash_bytes((hash), &(x), sizeof(x))
+
+/* Fields are hashed one by one rather than hashing the commands wholesale
+ * because of padding, and because text commands only have a pointer to
+ * their contents. Anything that influences the generated UI geometry that
+ * isn't in the render commands needs to be hashed here too. */
+static uint64_t gl_clay_commands_hash(Clay_RenderCommandArray *rcommands) {
+  uint64_t hash = 0xcbf29ce484222325ull;
+
+  /* text vertices are sized by the gui scale, and atlas entries by
+   * the size of the UI in framebuffer pixels */
+  hash = gl_HASH(hash, jeux.gui_scale);
+  hash = gl_HASH(hash, jeux.gl.pp.phys_win_size_x);
+  hash = gl_HASH(hash, jeux.gl.pp.fb_scale);
+
+  for (size_t i = 0; i < rcommands->length; i++) {
+    Clay_RenderCommand *rcmd = Clay_RenderCommandArray_Get(rcommands, i);
+    hash = gl_HASH(hash, rcmd->commandType);
+    hash = gl_HASH(hash, rcmd->boundingBox);
+
+    switch (rcmd->commandType) {
+      case CLAY_RENDER_COMMAND_TYPE_RECTANGLE: {
+        Clay_RectangleRenderData *config = &rcmd->renderData.rectangle;
+        hash = gl_HASH(hash, config->backgroundColor);
+        hash = gl_HASH(hash, config->cornerRadius);
+      } break;
+
+      case CLAY_RENDER_COMMAND_TYPE_TEXT: {
+        Clay_TextRenderData *config = &rcmd->renderData.text;
+        hash = gl_hash_bytes(hash, config->stringContents.chars, config->stringContents.length);
+        hash = gl_HASH(hash, config->textColor);
+        hash = gl_HASH(hash, config->fontSize);
+      } break;
+
+      case CLAY_RENDER_COMMAND_TYPE_BORDER: {
+        Clay_BorderRenderData *config = &rcmd->renderData.border;
+        hash = gl_HASH(hash, config->color);
+        hash = gl_HASH(hash, config->cornerRadius);
+        hash = gl_HASH(hash, config->width);
+      } break;
+
+      case CLAY_RENDER_COMMAND_TYPE_IMAGE: {
+        Clay_ImageRenderData *config = &rcmd->renderData.image;
+        hash = gl_HASH(hash, config->imageData);
+        hash = gl_HASH(hash, config->transform);
+      } break;
+
+      default: break;
+    }
+  }
+
+  return hash;
+}
+
+/* Adds an instance to this frame's UI batch, along with the triangles that
+ * draw it (their indices are relative to first_vtx) */
+static void gl_ui_batch_push(gl_ui_Instance inst, uint32_t first_vtx, gl_Tri *tri, size_t tri_count) {
+  /* out of room in the batch? */
+  size_t inst_i = jeux.gl.ui.batch.inst_wtr - jeux.gl.ui.batch.inst;
+  size_t idx_free = jeux.gl.ui.batch.idx + jx_COUNT(jeux.gl.ui.batch.idx) - jeux.gl.ui.batch.idx_wtr;
+  if (inst_i >= gl_ui_MAX_INSTANCES || idx_free < 3*tri_count) {
+    log_warn("UI batch is full, dropping something");
+    return;
+  }
+
+  *jeux.gl.ui.batch.inst_wtr++ = inst;
+
+  uint32_t base = (inst_i << 16) | first_vtx;
+  uint32_t *idx_wtr = jeux.gl.ui.batch.idx_wtr;
+  for (size_t tri_i = 0; tri_i < tri_count; tri_i++) {
+    *idx_wtr++ = base + tri[tri_i].a;
+    *idx_wtr++ = base + tri[tri_i].b;
+    *idx_wtr++ = base + tri[tri_i].c;
+  }
+  jeux.gl.ui.batch.idx_wtr = idx_wtr;
+}
 
-        a.p.x *=  scale.x; a.p.y *=  scale.y; a.p.z *=  scale.z;
-        b.p.x *=  scale.x; b.p.y *=  scale.y; b.p.z *=  scale.z;
-        a.p.x += center.x; a.p.y += center.y; a.p.z += center.z;
-        b.p.x += center.x; b.p.y += center.y; b.p.z += center.z;
+static void gl_ui_batch_push_model(gl_Model model, f4x4 mvp, Box2 clip) {
+  gl_ui_Instance inst = { .col0 = mvp.rows[0], .col1 = mvp.rows[1], .col3 = mvp.rows[3], .clip = clip };
+  gl_ui_batch_push(inst, jeux.gl.ui.batch.base_vtx[model], gl_modeldata[model].tri, gl_modeldata[model].tri_count);
+}
+
+/* inst.col* are filled in from bbox; everything else is up to you */
+static void gl_ui_batch_push_quad(gl_ui_Quad quad, Clay_BoundingBox bbox, float z, gl_ui_Instance inst) {
+  f4x4 placement = f4x4_move((f3) { bbox.x, bbox.y, z });
+  placement = f4x4_mul_affine(placement, f4x4_scale3((f3) { bbox.width, bbox.height, 1.0f }));
+  inst.col0 = placement.rows[0];
+  inst.col1 = placement.rows[1];
+  inst.col3 = placement.rows[3];
+
+  gl_Tri tri[] = { { 0, 1, 2 }, { 2, 3, 0 } };
+  gl_ui_batch_push(inst, gl_ui_QUAD_VTX + 4*quad, tri, jx_COUNT(tri));
+}
+
+/* Clay colors are 0-255, the batch wants them premultiplied */
+static f4 gl_ui_color(Clay_Color c) {
+  float a = c.a / 255.0f;
+  return (f4) { { c.r / 255.0f * a, c.g / 255.0f * a, c.b / 255.0f * a, a } };
+}
+
+static f4 gl_ui_corner_radius(Clay_CornerRadius r) {
+  return (f4) { { r.topLeft, r.topRight, r.bottomRight, r.bottomLeft } };
+}
+
+/* starts a new UI build, and throws everything out of the atlas if it was
+ * rasterized for a different scale or pixel density than what we have now */
+static void gl_ui_atlas_validate(void) {
+  float pixel_density = SDL_GetWindowPixelDensity(jeux.sdl.window);
+
+  jeux.gl.ui.atlas.build++;
+
+  bool stale = jeux.gl.ui.atlas.gui_scale     != jeux.gui_scale ||
+               jeux.gl.ui.atlas.pixel_density != pixel_density  ||
+               jeux.gl.ui.atlas.fb_scale      != jeux.gl.pp.fb_scale;
+  if (!stale) return;
+
+  jeux.gl.ui.atlas.gui_scale     = jeux.gui_scale;
+  jeux.gl.ui.atlas.pixel_density = pixel_density;
+  jeux.gl.ui.atlas.fb_scale      = jeux.gl.pp.fb_scale;
 
-        gl_geo_line(jeux_world_to_screen(a.xyz), jeux_world_to_screen(b.xyz), thickness, color);
+  jeux.gl.ui.atlas.entry_count  = 0;
+  jeux.gl.ui.atlas.raster_count = 0;
+  jeux.gl.ui.atlas.shelf_x      = 0;
+  jeux.gl.ui.atlas.shelf_y      = 0;
+  jeux.gl.ui.atlas.shelf_size_y = 0;
+}
+
+/* Finds (or makes room for) model rasterized with transform at size_x/size_y UI units.
+ * Returns false if it should just be drawn as geometry. */
+static bool gl_ui_atlas_get(gl_Model model, f4x4 transform, float size_x, float size_y, Box2 *uv) {
+  gl_ui_Atlas *atlas = &jeux.gl.ui.atlas;
+
+  /* UI units -> framebuffer pixels */
+  float scale = atlas->gui_scale * atlas->pixel_density * atlas->fb_scale;
+  int px_x = ceilf(size_x * scale);
+  int px_y = ceilf(size_y * scale);
+
+  /* if it's this big, it's going to hog the atlas */
+  if (px_x <= 0 || px_y <= 0 || px_x > atlas->size/2 || px_y > atlas->size/2) return false;
+
+  uint64_t transform_hash = gl_HASH(0xcbf29ce484222325ull, transform);
+
+  gl_ui_AtlasEntry *entry = NULL;
+  for (size_t i = 0; i < atlas->entry_count; i++) {
+    gl_ui_AtlasEntry *e = atlas->entries + i;
+    if (e->model == model && e->transform_hash == transform_hash &&
+        e->size_x == px_x && e->size_y == px_y) {
+      entry = e;
+      break;
+    }
+  }
+
+  if (entry == NULL) {
+    if (atlas->raster_count == gl_ui_ATLAS_MAX_ENTRIES) return false;
+
+    /* a pixel of padding on each side so linear filtering doesn't bleed */
+    int pad_x = px_x + 2;
+    int pad_y = px_y + 2;
+
+    /* start a new shelf if this doesn't fit on the current one */
+    bool new_shelf = atlas->shelf_x + pad_x > atlas->size;
+    int shelf_x = new_shelf ? 0 : atlas->shelf_x;
+    int shelf_y = new_shelf ? atlas->shelf_y + atlas->shelf_size_y : atlas->shelf_y;
+
+    if (atlas->entry_count < gl_ui_ATLAS_MAX_ENTRIES && shelf_y + pad_y <= atlas->size) {
+      if (new_shelf) atlas->shelf_size_y = 0;
+      atlas->shelf_x = shelf_x + pad_x;
+      atlas->shelf_y = shelf_y;
+      atlas->shelf_size_y = pad_y > atlas->shelf_size_y ? pad_y : atlas->shelf_size_y;
+
+      entry = atlas->entries + atlas->entry_count++;
+      entry->x = shelf_x + 1;
+      entry->y = shelf_y + 1;
+      entry->cell_x = pad_x;
+      entry->cell_y = pad_y;
+    } else {
+      /* out of room; take the spot of the least recently used entry it fits in,
+       * as long as that isn't being drawn in this build too */
+      for (size_t i = 0; i < atlas->entry_count; i++) {
+        gl_ui_AtlasEntry *e = atlas->entries + i;
+        if (e->last_used == atlas->build) continue;
+        if (e->cell_x < pad_x || e->cell_y < pad_y) continue;
+        if (entry == NULL || e->last_used < entry->last_used) entry = e;
       }
+      if (entry == NULL) return false;
     }
+
+    entry->model = model;
+    entry->transform_hash = transform_hash;
+    entry->size_x = px_x;
+    entry->size_y = px_y;
+
+    atlas->raster[atlas->raster_count++] = (gl_ui_AtlasRaster) {
+      .entry = *entry,
+      .transform = transform
+    };
+  }
+
+  entry->last_used = atlas->build;
+
+  float inv_size = 1.0f / atlas->size;
+  *uv = (Box2) {
+    { (entry->x                ) * inv_size, (entry->y                ) * inv_size },
+    { (entry->x + entry->size_x) * inv_size, (entry->y + entry->size_y) * inv_size },
+  };
+  return true;
+}
+
+/* draws the entries allocated this frame into the atlas */
+static void gl_ui_atlas_rasterize(void) {
+  gl_ui_Atlas *atlas = &jeux.gl.ui.atlas;
+
+  glBindFramebuffer(GL_FRAMEBUFFER, atlas->fb);
+  glDisable(GL_DEPTH_TEST);
+  glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+  glEnable(GL_BLEND);
+  glEnable(GL_SCISSOR_TEST);
+  glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+
+  glUseProgram(jeux.gl.geo.shader);
+
+  /* the UI assets are [0, 1] on both axes (after their transform) */
+  f4x4 projection = f4x4_ortho(0.0f, 1.0f, 0.0f, 1.0f, -1.0f, 1.0f);
+
+  for (size_t i = 0; i < atlas->raster_count; i++) {
+    gl_ui_AtlasEntry *e = &atlas->raster[i].entry;
+
+    /* clear the padding too */
+    glScissor(e->x - 1, e->y - 1, e->size_x + 2, e->size_y + 2);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glViewport(e->x, e->y, e->size_x, e->size_y);
+
+    glBindBuffer(GL_ARRAY_BUFFER, jeux.gl.geo.static_models[e->model].buf_vtx);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, jeux.gl.geo.static_models[e->model].buf_idx);
+    GEO_VTX_BIND_LAYOUT;
+
+    f4x4 mvp = f4x4_mul_affine(projection, atlas->raster[i].transform);
+    glUniformMatrix4fv(jeux.gl.geo.shader_u_mvp, 1, 0, mvp.floats);
+
+    glDrawElements(GL_TRIANGLES, 3 * jeux.gl.geo.static_models[e->model].tri_count, GL_UNSIGNED_SHORT, 0);
   }
+
+  atlas->raster_count = 0;
+
+  glDisable(GL_SCISSOR_TEST);
+  glDisable(GL_BLEND);
 }
 
-void gl_geo_box_rounded(f3 min, f3 max, Color color, float r);
 /**
  * WARNING: This Clay renderer has "character":
  *
- *  [x] We only take into account cornerRadius.topLeft. Other corners? Fuck 'em.
- *      (whatever radius is supplied for the other corners, cornerRadius.topLeft
- *      is used instead; you can make rounded rectangles, but not tabs)
+ *  [x] Rectangles and borders are one quad each, shaded with a signed distance
+ *      function, so every corner gets its own radius. Borders are drawn on the
+ *      inside of the bounding box.
  *
- *  [x] 2 + n draw calls, one for dynamic shapes, n for assets, one afterwards for text.
+ *  [x] 2 draw calls, one for shapes and assets, one afterwards for text.
  *      (Text has its own AA, so it happens after postprocessing.)
  *
- *  [x] We reproject UVs instead of using scissor. (this allows just 2 draw calls)
+ *  [x] We reproject UVs instead of using scissor for text, and assets are clipped
+ *      per-instance in their shader. (this keeps the draw calls from multiplying)
+ *
+ *  [x] Assets are rasterized into an atlas the first time they're seen at a size,
+ *      so the image transform must be affine in x/y (it's baked into the atlas).
+ *      When it fills up, the least recently used entries get drawn over; if
+ *      nothing can make way, the asset is drawn as geometry instead.
  *
  *  [x] The first pass that draws shapes uses the same geometry buffers and shaders
  *      as things in the 3D scene, so we can easily draw the character in your inventory.
  *
  *  [x] UI is at z=0.99, draw over that to draw over the UI.
  *
+ *  [x] If the render commands hash the same as last frame's, nothing is regenerated
+ *      or uploaded. If you draw UI from somewhere that isn't a render command, make
+ *      sure it ends up in gl_clay_commands_hash, or it won't update.
+ *
  *  [x] clay.h's "imageData" has been changed from "void *" to a "size_t",
  *      which is interpreted as a gl_Model. (image commands actually draw 3D
  *      geometry, and all the 2D UI assets are secretly 3D models)
@@ -1215,6 +2327,26 @@ static void gl_draw_clay_commands(Clay_RenderCommandArray *rcommands) {
   float ui_z = 0.99f;
   float ui_z_bump = 0.00001f;
 
+  /* nothing changed? last frame's buffers are still good */
+  {
+    uint64_t hash = gl_clay_commands_hash(rcommands);
+    if (jeux.gl.ui.valid && jeux.gl.ui.hash == hash) return;
+
+    jeux.gl.ui.hash = hash;
+    jeux.gl.ui.valid = true;
+    jeux.gl.ui.dirty = true;
+  }
+
+  gl_ui_atlas_validate();
+
+  /* start over; this relies on no other text having been drawn yet this frame */
+  jeux.gl.geo.dyn_geo_ui.vtx_wtr = jeux.gl.geo.dyn_geo_ui.vtx;
+  jeux.gl.geo.dyn_geo_ui.idx_wtr = jeux.gl.geo.dyn_geo_ui.idx;
+  jeux.gl.ui.batch.inst_wtr = jeux.gl.ui.batch.inst;
+  jeux.gl.ui.batch.idx_wtr = jeux.gl.ui.batch.idx;
+  jeux.gl.text.vtx_wtr = jeux.gl.text.vtx;
+  jeux.gl.text.idx_wtr = jeux.gl.text.idx;
+
   /* we want to write to the ui geo buf (scaled by ui scale) in this function */
   jeux.gl.geo.dyn = &jeux.gl.geo.dyn_geo_ui;
 
@@ -1227,26 +2359,11 @@ static void gl_draw_clay_commands(Clay_RenderCommandArray *rcommands) {
       case CLAY_RENDER_COMMAND_TYPE_RECTANGLE: {
         Clay_RectangleRenderData *config = &rcmd->renderData.rectangle;
 
-        f3 min = { rect.x             , rect.y              , ui_z };
-        f3 max = { rect.x + rect.width, rect.y + rect.height, ui_z };
-        Color color = {
-          config->backgroundColor.r,
-          config->backgroundColor.g,
-          config->backgroundColor.b,
-          config->backgroundColor.a
-        };
-
-        if (config->cornerRadius.topLeft == 0.0f) {
-          gl_geo_box(
-            (f3) { min.x, min.y, ui_z },
-            (f3) { max.x, max.y, ui_z },
-            color
-          );
-        } else {
-          float r = config->cornerRadius.topLeft;
-
-          gl_geo_box_rounded(min, max, color, r);
-        }
+        gl_ui_batch_push_quad(gl_ui_Quad_Fill, rect, ui_z, (gl_ui_Instance) {
+          .clip = clip,
+          .radius = gl_ui_corner_radius(config->cornerRadius),
+          .color = gl_ui_color(config->backgroundColor),
+        });
 
         ui_z += ui_z_bump;
       } break;
@@ -1273,62 +2390,16 @@ static void gl_draw_clay_commands(Clay_RenderCommandArray *rcommands) {
         ui_z += ui_z_bump;
 
         Clay_BorderRenderData *config = &rcmd->renderData.border;
-        Color color = {
-          config->color.r,
-          config->color.g,
-          config->color.b,
-          config->color.a
-        };
-
-        f3 min = { rect.x             , rect.y              , ui_z };
-        f3 max = { rect.x + rect.width, rect.y + rect.height, ui_z };
-        float r = config->cornerRadius.topLeft;
-
-        {
-          float t;
-          t = config->width.top;
-          gl_geo_line(
-            (f3){ min.x - t*0.5f + r, min.y, ui_z },
-            (f3){ max.x + t*0.5f - r, min.y, ui_z },
-            t,
-            color
-          );
-
-          t = config->width.left;
-          gl_geo_line(
-            (f3){ min.x, max.y + t*0.5f - r, ui_z },
-            (f3){ min.x, min.y - t*0.5f + r, ui_z },
-            t,
-            color
-          );
-
-          t = config->width.bottom;
-          gl_geo_line(
-            (f3){ max.x + t*0.5f - r, max.y, ui_z },
-            (f3){ min.x - t*0.5f + r, max.y, ui_z },
-            t,
-            color
-          );
-
-          t = config->width.right;
-          gl_geo_line(
-            (f3){ max.x, min.y - t*0.5f + r, ui_z },
-            (f3){ max.x, max.y + t*0.5f - r, ui_z },
-            t,
-            color
-          );
-        }
-
-        {
-          /* probably fine just to use the top as the width of all of these */
-          float t = config->width.top;
-          float q = M_PI * 0.5f;
-          gl_geo_ring2_arc(2*q, 3*q, 16, (f3) { min.x + r, min.y + r, ui_z }, r, t, color);
-          gl_geo_ring2_arc(1*q, 2*q, 16, (f3) { min.x + r, max.y - r, ui_z }, r, t, color);
-          gl_geo_ring2_arc(3*q, 4*q, 16, (f3) { max.x - r, min.y + r, ui_z }, r, t, color);
-          gl_geo_ring2_arc(0*q, 1*q, 16, (f3) { max.x - r, max.y - r, ui_z }, r, t, color);
-        }
-
+        Clay_BorderWidth w = config->width;
+        if (w.left == 0 && w.top == 0 && w.right == 0 && w.bottom == 0) break;
+
+        /* drawn on the inside of the bounding box */
+        gl_ui_batch_push_quad(gl_ui_Quad_Border, rect, ui_z, (gl_ui_Instance) {
+          .clip = clip,
+          .radius = gl_ui_corner_radius(config->cornerRadius),
+          .border = { { w.left, w.top, w.right, w.bottom } },
+          .color = gl_ui_color(config->color),
+        });
       } break;
 
       case CLAY_RENDER_COMMAND_TYPE_SCISSOR_START: {
@@ -1346,29 +2417,37 @@ static void gl_draw_clay_commands(Clay_RenderCommandArray *rcommands) {
       case CLAY_RENDER_COMMAND_TYPE_IMAGE: {
         Clay_BoundingBox bbox = rcmd->boundingBox;
 
-        f4x4 mvp = f4x4_move((f3) { bbox.x, bbox.y, ui_z });
-        mvp = f4x4_mul_f4x4(mvp, f4x4_scale3((f3) { bbox.width, bbox.height, 1.0f }));
-        mvp = f4x4_mul_f4x4(mvp, rcmd->renderData.image.transform);
-
-        *jeux.gl.geo.model_draws_wtr++ = (gl_ModelDraw) {
-          .model = rcmd->renderData.image.imageData,
-          .matrix = mvp,
-          .scissor = clip,
-          .two_dee_ui = true,
-        };
+        gl_Model model = rcmd->renderData.image.imageData;
+        f4x4 transform = rcmd->renderData.image.transform;
+        Box2 uv;
+        if (gl_ui_atlas_get(model, transform, bbox.width, bbox.height, &uv)) {
+          /* the atlas already has the transform baked in */
+          gl_ui_batch_push_quad(gl_ui_Quad_Atlas, bbox, ui_z, (gl_ui_Instance) { .clip = clip, .uv = uv });
+        } else {
+          f4x4 mvp = f4x4_move((f3) { bbox.x, bbox.y, ui_z });
+          mvp = f4x4_mul_affine(mvp, f4x4_scale3((f3) { bbox.width, bbox.height, 1.0f }));
+          mvp = f4x4_mul_affine(mvp, transform);
+          gl_ui_batch_push_model(model, mvp, clip);
+        }
       } break;
 
       default:
-        SDL_Log("Unknown render command type: %d", rcmd->commandType);
+        log_warn("Unknown render command type: %d", rcmd->commandType);
     }
   }
 
   /* go back to writing to the world buf */
   jeux.gl.geo.dyn = &jeux.gl.geo.dyn_geo_world;
+
+  jeux.gl.ui.text_vtx_count = jeux.gl.text.vtx_wtr - jeux.gl.text.vtx;
+  jeux.gl.ui.text_idx_count = jeux.gl.text.idx_wtr - jeux.gl.text.idx;
 }
 
 
 static void gl_render(void) {
+  /* UI assets that are new to the atlas */
+  if (jeux.gl.ui.atlas.raster_count > 0) gl_ui_atlas_rasterize();
+
   {
     /* switch to the fb that gets postprocessing applied later */
     glViewport(0, 0, jeux.gl.pp.phys_win_size_x*jeux.gl.pp.fb_scale, jeux.gl.pp.phys_win_size_y*jeux.gl.pp.fb_scale);
@@ -1397,8 +2476,12 @@ static void gl_render(void) {
         gl_DynGeo *dyn = dyn_geos[i];
         f4x4 *mvp = dyn_geos_mvps[i];
 
-        /* upload data into dynamic buffers */
-        {
+        /* the UI's shapes are in its batch now, so this is usually empty */
+        if (dyn->idx_wtr == dyn->idx) continue;
+
+        /* upload data into dynamic buffers (the UI only if it changed) */
+        bool retained = dyn == &jeux.gl.geo.dyn_geo_ui && !jeux.gl.ui.dirty;
+        if (!retained) {
           gl_geo_Vtx *vtx = dyn->vtx;
           gl_Tri     *idx = dyn->idx;
 
@@ -1415,6 +2498,8 @@ static void gl_render(void) {
           }
         }
 
+        glBindBuffer(GL_ARRAY_BUFFER, dyn->buf_vtx);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, dyn->buf_idx);
         GEO_VTX_BIND_LAYOUT;
 
         glUniformMatrix4fv(jeux.gl.geo.shader_u_mvp, 1, 0, mvp->floats);
@@ -1438,41 +2523,169 @@ static void gl_render(void) {
 
         GEO_VTX_BIND_LAYOUT;
 
-        if (draw->two_dee_ui) {
-          f4x4 mvp = jeux.ui_transform;
-          mvp = f4x4_mul_f4x4(mvp, draw->matrix);
+        f4x4 mvp = jeux.camera;
+        mvp = f4x4_mul_affine(mvp, draw->matrix);
+        glUniformMatrix4fv(jeux.gl.geo.shader_u_mvp, 1, 0, mvp.floats);
 
-          glUniformMatrix4fv(jeux.gl.geo.shader_u_mvp, 1, 0, mvp.floats);
+        glDrawElements(GL_TRIANGLES, 3 * tri_count, GL_UNSIGNED_SHORT, 0);
+      }
 
-          bool do_scissor = (!SDL_isinf(draw->scissor.min.x)) ||
-                            (!SDL_isinf(draw->scissor.max.y)) ||
-                            (!SDL_isinf(draw->scissor.min.x)) ||
-                            (!SDL_isinf(draw->scissor.max.y));
+    }
 
-          if (do_scissor) {
-            glEnable(GL_SCISSOR_TEST);
+    /* draw every CAD box in one go (see gl_State.cad_boxes) */
+    if (jeux.gl.cad_boxes.count > 0) {
+      glUseProgram(jeux.gl.cad_boxes.shader);
 
-            f3 corner0 = jeux_ui_to_viewport((f3) { draw->scissor.min.x, draw->scissor.min.y, 0 });
-            f3 corner1 = jeux_ui_to_viewport((f3) { draw->scissor.max.x, draw->scissor.max.y, 0 });
-            float min_x = fminf(corner0.x, corner1.x);
-            float min_y = fminf(corner0.y, corner1.y);
-            float max_x = fmaxf(corner0.x, corner1.x);
-            float max_y = fmaxf(corner0.y, corner1.y);
-            glScissor(min_x, min_y, max_x - min_x, max_y - min_y);
-          }
+      glActiveTexture(GL_TEXTURE0);
+      glBindTexture(GL_TEXTURE_2D, jeux.gl.cad_boxes.tex_inst);
+      glUniform1i(jeux.gl.cad_boxes.shader_u_tex_inst, 0);
 
-          glDrawElements(GL_TRIANGLES, 3 * tri_count, GL_UNSIGNED_SHORT, 0);
-
-          glDisable(GL_SCISSOR_TEST);
-        } else {
-          f4x4 mvp = jeux.camera;
-          mvp = f4x4_mul_f4x4(mvp, draw->matrix);
-          glUniformMatrix4fv(jeux.gl.geo.shader_u_mvp, 1, 0, mvp.floats);
+      /* upload the rows that changed, a run of them at a time */
+      size_t row_texels = gl_cad_ROW * sizeof(gl_cad_Instance) / sizeof(float[4]);
+      for (size_t row = 0; row < gl_cad_ROWS;) {
+        if (!(jeux.gl.cad_boxes.dirty[row / 64] & (1ull << (row % 64)))) { row++; continue; }
 
-          glDrawElements(GL_TRIANGLES, 3 * tri_count, GL_UNSIGNED_SHORT, 0);
+        size_t end = row;
+        while (end < gl_cad_ROWS && (jeux.gl.cad_boxes.dirty[end / 64] & (1ull << (end % 64)))) {
+          jeux.gl.cad_boxes.dirty[end / 64] &= ~(1ull << (end % 64));
+          end++;
         }
+        glTexSubImage2D(
+          GL_TEXTURE_2D,
+          0,
+          0, row,
+          row_texels, end - row,
+          GL_RGBA,
+          GL_FLOAT,
+          jeux.gl.cad_boxes.inst + row*gl_cad_ROW
+        );
+        row = end;
+      }
+
+      /* no vertex attributes, it's all gl_VertexID and gl_InstanceID */
+      glDisableVertexAttribArray(jeux.gl.geo.shader_a_pos);
+      glDisableVertexAttribArray(jeux.gl.geo.shader_a_color);
+      glDisableVertexAttribArray(jeux.gl.geo.shader_a_normal);
+
+      float angle = jeux.gl.light.angle;
+      float height = jeux.gl.light.height;
+      f3 light_dir = f3_norm((f3) { cosf(angle), sinf(angle), height });
+      glUniform3f(jeux.gl.cad_boxes.shader_u_light_dir, light_dir.x, light_dir.y, light_dir.z);
+
+      Color c = jeux.gl.cad_boxes.color, h = jeux.gl.cad_boxes.hover_color;
+      glUniform4f(jeux.gl.cad_boxes.shader_u_color,       c.r/255.0f, c.g/255.0f, c.b/255.0f, c.a/255.0f);
+      glUniform4f(jeux.gl.cad_boxes.shader_u_hover_color, h.r/255.0f, h.g/255.0f, h.b/255.0f, h.a/255.0f);
+      glUniform1i(jeux.gl.cad_boxes.shader_u_hovered, jeux.gl.cad_boxes.hovered);
+      glUniformMatrix4fv(jeux.gl.cad_boxes.shader_u_mvp, 1, 0, jeux.camera.floats);
+
+      glDrawArraysInstanced(GL_TRIANGLES, 0, 6 * 6, jeux.gl.cad_boxes.count);
+    }
+
+    /* draw every stick figure in one go (see gl_State.figure) */
+    if (jeux.gl.figure.count > 0) {
+      size_t count = jeux.gl.figure.count;
+
+      glUseProgram(jeux.gl.figure.shader);
+
+      glActiveTexture(GL_TEXTURE2);
+      glBindTexture(GL_TEXTURE_2D, jeux.gl.figure.tex_clips);
+      glUniform1i(jeux.gl.figure.shader_u_tex_clips, 2);
+
+      glActiveTexture(GL_TEXTURE1);
+      glBindTexture(GL_TEXTURE_2D, jeux.gl.figure.tex_anims);
+      glUniform1i(jeux.gl.figure.shader_u_tex_anims, 1);
+
+      glActiveTexture(GL_TEXTURE0);
+      glBindTexture(GL_TEXTURE_2D, jeux.gl.figure.tex_joints);
+      glUniform1i(jeux.gl.figure.shader_u_tex_joints, 0);
+
+      /* either the joints themselves or just what to animate them with */
+      glUniform1i(jeux.gl.figure.shader_u_gpu_anim, jeux.gl.figure.gpu_anim);
+      if (jeux.gl.figure.gpu_anim) {
+        glActiveTexture(GL_TEXTURE1);
+        glTexSubImage2D(
+          GL_TEXTURE_2D,
+          0,
+          0, 0,
+          sizeof(gl_figure_Anim) / sizeof(float[4]), count,
+          GL_RGBA,
+          GL_FLOAT,
+          jeux.gl.figure.anims
+        );
+        glActiveTexture(GL_TEXTURE0);
+      } else {
+        glTexSubImage2D(
+          GL_TEXTURE_2D,
+          0,
+          0, 0,
+          gl_figure_MAX_JOINTS, count,
+          GL_RGBA,
+          GL_FLOAT,
+          jeux.gl.figure.joints
+        );
       }
 
+      /* no vertex attributes, it's all gl_VertexID and gl_InstanceID */
+      glDisableVertexAttribArray(jeux.gl.geo.shader_a_pos);
+      glDisableVertexAttribArray(jeux.gl.geo.shader_a_color);
+      glDisableVertexAttribArray(jeux.gl.geo.shader_a_normal);
+
+      glUniformMatrix4fv(jeux.gl.figure.shader_u_mvp, 1, 0, jeux.camera.floats);
+      glUniform2f(jeux.gl.figure.shader_u_win_size, jeux.win_size_x, jeux.win_size_y);
+      glUniform1f(jeux.gl.figure.shader_u_radius, jeux.gl.figure.radius);
+      Color color = jeux.gl.figure.color;
+      glUniform4f(jeux.gl.figure.shader_u_color, color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f);
+
+      glDrawArraysInstanced(GL_TRIANGLES, 0, 6 * jeux.gl.figure.limb_count, count);
+    }
+
+    /* draw every UI asset in one go (see gl_State.ui.batch) */
+    {
+      size_t inst_count = jeux.gl.ui.batch.inst_wtr - jeux.gl.ui.batch.inst;
+      size_t idx_count  = jeux.gl.ui.batch.idx_wtr  - jeux.gl.ui.batch.idx;
+
+      glUseProgram(jeux.gl.ui.batch.shader);
+
+      glActiveTexture(GL_TEXTURE2);
+      glBindTexture(GL_TEXTURE_2D, jeux.gl.ui.atlas.tex);
+      glUniform1i(jeux.gl.ui.batch.shader_u_tex_atlas, 2);
+
+      glActiveTexture(GL_TEXTURE1);
+      glBindTexture(GL_TEXTURE_2D, jeux.gl.ui.batch.tex_inst);
+      glUniform1i(jeux.gl.ui.batch.shader_u_tex_inst, 1);
+
+      glActiveTexture(GL_TEXTURE0);
+      glBindTexture(GL_TEXTURE_2D, jeux.gl.ui.batch.tex_vtx);
+      glUniform1i(jeux.gl.ui.batch.shader_u_tex_vtx, 0);
+
+      glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, jeux.gl.ui.batch.buf_idx);
+
+      /* only changes when the UI does */
+      if (jeux.gl.ui.dirty && inst_count > 0) {
+        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, sizeof(uint32_t) * idx_count, jeux.gl.ui.batch.idx);
+
+        glActiveTexture(GL_TEXTURE1);
+        glTexSubImage2D(
+          GL_TEXTURE_2D,
+          0,
+          0, 0,
+          sizeof(gl_ui_Instance) / sizeof(float[4]), inst_count,
+          GL_RGBA,
+          GL_FLOAT,
+          jeux.gl.ui.batch.inst
+        );
+        glActiveTexture(GL_TEXTURE0);
+      }
+
+      /* the batch pulls its vertices out of textures; leaving these enabled
+       * would have GL validating our (instance << 16) indices against them */
+      glDisableVertexAttribArray(jeux.gl.geo.shader_a_pos);
+      glDisableVertexAttribArray(jeux.gl.geo.shader_a_color);
+      glDisableVertexAttribArray(jeux.gl.geo.shader_a_normal);
+
+      glUniformMatrix4fv(jeux.gl.ui.batch.shader_u_mvp, 1, 0, jeux.ui_transform.floats);
+
+      if (idx_count > 0) glDrawElements(GL_TRIANGLES, idx_count, GL_UNSIGNED_INT, 0);
     }
 
     /* note: if you run the postprocessing with depth enabled,
@@ -1518,21 +2731,23 @@ static void gl_render(void) {
   {
     glUseProgram(jeux.gl.text.shader);
 
-    /* update VBO contents */
+    /* update VBO contents - skipping the UI's part of it if that's retained */
     {
-      gl_text_Vtx *vtx = jeux.gl.text.vtx;
-      gl_Tri      *idx = jeux.gl.text.idx;
+      size_t vtx_start = jeux.gl.ui.dirty ? 0 : jeux.gl.ui.text_vtx_count;
+      size_t idx_start = jeux.gl.ui.dirty ? 0 : jeux.gl.ui.text_idx_count;
+      gl_text_Vtx *vtx = jeux.gl.text.vtx + vtx_start;
+      gl_Tri      *idx = jeux.gl.text.idx + idx_start;
 
       {
         glBindBuffer(GL_ARRAY_BUFFER, jeux.gl.text.buf_vtx);
         size_t len = jeux.gl.text.vtx_wtr - vtx;
-        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vtx[0]) * len, vtx);
+        if (len) glBufferSubData(GL_ARRAY_BUFFER, sizeof(vtx[0]) * vtx_start, sizeof(vtx[0]) * len, vtx);
       }
 
       {
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, jeux.gl.text.buf_idx);
         size_t len = jeux.gl.text.idx_wtr - idx;
-        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, sizeof(idx[0]) * len, idx);
+        if (len) glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, sizeof(idx[0]) * idx_start, sizeof(idx[0]) * len, idx);
       }
     }
 
@@ -1572,6 +2787,9 @@ static void gl_render(void) {
     glDisable(GL_BLEND);
     glDisable(GL_DEPTH_TEST);
   }
+
+  /* everything the UI needs is on the GPU now */
+  jeux.gl.ui.dirty = false;
 }
 
 #endif
@@ -12,6 +12,9 @@ typedef struct {
   struct {
     ui_WabisabiWindow window;
     float gui_scale_tmp;
+    /* set when the slider is released; applied by gui_frame_begin
+     * so the layout for this frame stays in one consistent scale */
+    bool gui_scale_dirty;
   } options;
 
   /* the element who owns the current mouse down action */
@@ -25,6 +28,7 @@ typedef struct {
 } gui_State;
 
 static void gui_init(void);
+static void gui_frame_begin(void);
 static void gui_frame(void);
 
 #endif
@@ -82,7 +86,7 @@ const uint16_t TEXT_SIZE_BODY = 24;
 #define UI_IMAGE_FIT(image) (Clay_ImageElementConfig) { \
   .sourceDimensions = { model_##image##_size_x, model_##image##_size_y }, \
   .imageData = gl_Model_##image, \
-  .transform = f4x4_mul_f4x4( \
+  .transform = f4x4_mul_affine( \
     f4x4_scale3((f3) { 1/model_##image##_size_x, 1/model_##image##_size_y, 1.0f }), \
     f4x4_move((f3) { -0.5f*(1 - model_##image##_size_x), -0.5f*(1 - model_##image##_size_y), 0.0f }) \
   ) \
@@ -160,9 +164,12 @@ static bool ui_slider(Clay_ElementId id, float *state, float min, float max) {
     });
     CLAY({ .layout.sizing.height = CLAY_SIZING_GROW(0) });
 
-    Clay_BoundingBox bbox = Clay_GetElementData(id).boundingBox;
+    /* this is last frame's bbox; the first frame we're laid out,
+     * there isn't one, so don't draw a zero-width slider */
+    Clay_ElementData data = Clay_GetElementData(id);
+    Clay_BoundingBox bbox = data.boundingBox;
 
-    CLAY({
+    if (data.found) CLAY({
       .floating.attachTo = CLAY_ATTACH_TO_PARENT,
       .floating.attachPoints.element = CLAY_ATTACH_POINT_CENTER_CENTER,
       .floating.attachPoints.parent = CLAY_ATTACH_POINT_CENTER_CENTER,
@@ -172,7 +179,7 @@ static bool ui_slider(Clay_ElementId id, float *state, float min, float max) {
     }
 
     float prog = inv_lerp(min, max, *state);
-    CLAY({
+    if (data.found) CLAY({
       .floating.attachTo = CLAY_ATTACH_TO_PARENT,
       .floating.attachPoints.element = CLAY_ATTACH_POINT_CENTER_CENTER,
       .floating.attachPoints.parent = CLAY_ATTACH_POINT_LEFT_CENTER,
@@ -233,8 +240,8 @@ static bool ui_arrow_button(bool left) {
 
       f4x4 mvp = f4x4_move((f3) { 0.5, 0.5, 0 });
       /* you can also use f4x4_turn() here to rotate components around their center */
-      mvp = f4x4_mul_f4x4(mvp, f4x4_scale3((f3) { left ? 1 : -1, 1, 1 }));
-      mvp = f4x4_mul_f4x4(mvp, f4x4_move((f3) { -0.5f, -0.5f, 0 }));
+      mvp = f4x4_mul_affine(mvp, f4x4_scale3((f3) { left ? 1 : -1, 1, 1 }));
+      mvp = f4x4_mul_affine(mvp, f4x4_move((f3) { -0.5f, -0.5f, 0 }));
       ui_icon_f4x4(gl_Model_UiArrowButton, icon_size, mvp);
     }
   };
@@ -521,20 +528,7 @@ static void ui_window_content_options(void) {
           gui_scale_max
         );
 
-        if (released) {
-          f3 p = { gui.options.window.x, gui.options.window.y };
-          p = f4x4_transform_f3(jeux.ui_transform, p);
-
-          jeux.gui_scale = gui.options.gui_scale_tmp;
-          gl_resize();
-
-          p = f4x4_transform_f3(f4x4_invert(jeux.ui_transform), p);
-          gui.options.window.x = fmaxf(p.x, 0);
-          gui.options.window.y = fmaxf(p.y, 0);
-
-          f3 ui = jeux_screen_to_ui((f3) { jeux.win_size_x, jeux.win_size_y, 0 });
-          Clay_SetLayoutDimensions((Clay_Dimensions) { ui.x, ui.y });
-        }
+        if (released) gui.options.gui_scale_dirty = true;
       }
     }
 
@@ -601,6 +595,39 @@ static void ui_window_content_options(void) {
       CLAY(pair_inner) { ui_slider(CLAY_ID("LIGHT_HEIGHT_SLIDER"), &jeux.gl.light.height, 0.1f, 4.0f); }
     }
 
+    /* "CROWD" header */
+    CLAY({ .layout.sizing.height = CLAY_SIZING_FIXED(30) });
+    CLAY_TEXT(CLAY_STRING("CROWD"), CLAY_TEXT_CONFIG({ .fontSize = 30, .textColor = ui_ink }));
+    CLAY({ .layout.sizing.height = CLAY_SIZING_FIXED(20) });
+
+    /* NPC count slider */
+    CLAY(pair) {
+      CLAY(pair_inner) { CLAY_TEXT(CLAY_STRING("NPCS"), CLAY_TEXT_CONFIG(label)); }
+      CLAY(pair_inner) { ui_slider(CLAY_ID("CROWD_SLIDER"), &jeux.sim.characters.debug_crowd, 0, 200); }
+    }
+
+    /* animate on the GPU checkbox */
+    CLAY(pair) {
+      CLAY(pair_inner) { CLAY_TEXT(CLAY_STRING("GPU ANIM"), CLAY_TEXT_CONFIG(label)); }
+
+      CLAY({ .layout.sizing = { .width = CLAY_SIZING_GROW(0) } }) {
+        CLAY({ .layout.sizing.width = CLAY_SIZING_GROW(0) });
+        ui_checkbox(&jeux.gl.figure.gpu_anim);
+        CLAY({ .layout.sizing.width = CLAY_SIZING_GROW(0) });
+      }
+    }
+
+    /* draw the flow field checkbox */
+    CLAY(pair) {
+      CLAY(pair_inner) { CLAY_TEXT(CLAY_STRING("FLOW FIELD"), CLAY_TEXT_CONFIG(label)); }
+
+      CLAY({ .layout.sizing = { .width = CLAY_SIZING_GROW(0) } }) {
+        CLAY({ .layout.sizing.width = CLAY_SIZING_GROW(0) });
+        ui_checkbox(&jeux.sim.nav.debug_draw);
+        CLAY({ .layout.sizing.width = CLAY_SIZING_GROW(0) });
+      }
+    }
+
 
 #endif
 
@@ -608,28 +635,28 @@ static void ui_window_content_options(void) {
 }
 
 
-void gl_geo_box_rounded(f3 min, f3 max, Color color, float r) {
-  /* corner arcs */
-  {
-    float q = M_PI * 0.5f;
-    gl_geo_arc(2*q, 3*q, 16, (f3) { min.x + r, min.y + r, max.z }, r, color);
-    gl_geo_arc(1*q, 2*q, 16, (f3) { min.x + r, max.y - r, max.z }, r, color);
-    gl_geo_arc(3*q, 4*q, 16, (f3) { max.x - r, min.y + r, max.z }, r, color);
-    gl_geo_arc(0*q, 1*q, 16, (f3) { max.x - r, max.y - r, max.z }, r, color);
-  }
+static void gui_frame_begin(void) {
+  if (gui.options.gui_scale_dirty) {
+    gui.options.gui_scale_dirty = false;
+
+    f3 p = { gui.options.window.x, gui.options.window.y };
+    p = f4x4_transform_f3(jeux.ui_transform, p);
 
-  /* min and max inset by radius */
-  f3 rmin = { min.x + r, min.y + r, max.z };
-  f3 rmax = { max.x - r, max.y - r, max.z };
-  gl_geo_box(rmin, rmax, color);
-
-  float h = r * 0.5f;
-  rmin = (f3) { min.x + h, min.y + h, max.z };
-  rmax = (f3) { max.x - h, max.y - h, max.z };
-  gl_geo_line((f3) { rmin.x+h, rmin.y  , max.z }, (f3) { rmax.x-h, rmin.y  , max.z }, r, color);
-  gl_geo_line((f3) { rmin.x  , rmax.y-h, max.z }, (f3) { rmin.x  , rmin.y+h, max.z }, r, color);
-  gl_geo_line((f3) { rmax.x-h, rmax.y  , max.z }, (f3) { rmin.x+h, rmax.y  , max.z }, r, color);
-  gl_geo_line((f3) { rmax.x  , rmin.y+h, max.z }, (f3) { rmax.x  , rmax.y-h, max.z }, r, color);
+    jeux.gui_scale = gui.options.gui_scale_tmp;
+    gl_resize();
+
+    p = f4x4_transform_f3(f4x4_invert_ortho(jeux.ui_transform), p);
+    gui.options.window.x = fmaxf(p.x, 0);
+    gui.options.window.y = fmaxf(p.y, 0);
+
+    f3 ui = jeux_screen_to_ui((f3) { jeux.win_size_x, jeux.win_size_y, 0 });
+    Clay_SetLayoutDimensions((Clay_Dimensions) { ui.x, ui.y });
+
+    /* the mouse hasn't moved, but the space it's measured in has */
+    ui = jeux_screen_to_ui((f3) { jeux.mouse_screen_x, jeux.mouse_screen_y, 0 });
+    jeux.mouse_ui_x = ui.x;
+    jeux.mouse_ui_y = ui.y;
+  }
 }
 
 static void gui_frame(void) {
@@ -721,7 +748,7 @@ static void gui_frame(void) {
 }
 
 static void gui_handle_errors(Clay_ErrorData error_data) {
-  SDL_Log("%s\n", error_data.errorText.chars);
+  log_warn("clay: %s", error_data.errorText.chars);
 }
 
 static Clay_Dimensions gui_measure_text(
@@ -0,0 +1,114 @@
+// vim: sw=2 ts=2 expandtab smartindent
+#ifndef jobs_IMPLEMENTATION
+
+/* A pool of worker threads (one per core, minus the main thread's) for
+ * splitting a loop across cores. jobs_parallel_for calls fn on batches
+ * of [0, count) from every worker and the calling thread, and returns
+ * once they're all done. Not reentrant: only call it from the main thread. */
+
+typedef void (*jobs_Fn)(void *data, size_t begin, size_t end);
+
+#define jobs_MAX_WORKERS 15
+
+static void jobs_init(void);
+static void jobs_quit(void);
+static void jobs_parallel_for(size_t count, size_t batch, jobs_Fn fn, void *data);
+#endif
+
+#ifdef jobs_IMPLEMENTATION
+
+static struct {
+  SDL_Thread *workers[jobs_MAX_WORKERS];
+  int worker_count;
+
+  /* one signal per worker per job, both ways */
+  SDL_Semaphore *start, *done;
+  SDL_AtomicInt quit;
+
+  /* the job in progress; written before start is signaled */
+  jobs_Fn fn;
+  void *data;
+  size_t count, batch;
+  SDL_AtomicInt next;
+} jobs_state;
+
+static void jobs_run_batches(void) {
+  for (;;) {
+    size_t begin = SDL_AddAtomicInt(&jobs_state.next, (int)jobs_state.batch);
+    if (begin >= jobs_state.count) break;
+
+    size_t end = begin + jobs_state.batch;
+    if (end > jobs_state.count) end = jobs_state.count;
+    jobs_state.fn(jobs_state.data, begin, end);
+  }
+}
+
+static int jobs_worker(void *data) {
+  for (;;) {
+    SDL_WaitSemaphore(jobs_state.start);
+    if (SDL_GetAtomicInt(&jobs_state.quit)) return 0;
+
+    jobs_run_batches();
+    SDL_SignalSemaphore(jobs_state.done);
+  }
+}
+
+static void jobs_init(void) {
+  int cores = SDL_GetNumLogicalCPUCores();
+  int worker_count = cores - 1;
+  if (worker_count > jobs_MAX_WORKERS) worker_count = jobs_MAX_WORKERS;
+  if (worker_count <= 0) return;
+
+  jobs_state.start = SDL_CreateSemaphore(0);
+  jobs_state.done  = SDL_CreateSemaphore(0);
+  if (jobs_state.start == NULL || jobs_state.done == NULL) {
+    log_error("jobs: couldn't make semaphores: %s", SDL_GetError());
+    return;
+  }
+
+  for (int i = 0; i < worker_count; i++) {
+    SDL_Thread *thread = SDL_CreateThread(jobs_worker, "jobs", NULL);
+    if (thread == NULL) {
+      log_error("jobs: couldn't start worker %d: %s", i, SDL_GetError());
+      break;
+    }
+    jobs_state.workers[jobs_state.worker_count++] = thread;
+  }
+}
+
+static void jobs_quit(void) {
+  SDL_SetAtomicInt(&jobs_state.quit, 1);
+  for (int i = 0; i < jobs_state.worker_count; i++) SDL_SignalSemaphore(jobs_state.start);
+  for (int i = 0; i < jobs_state.worker_count; i++) SDL_WaitThread(jobs_state.workers[i], NULL);
+  jobs_state.worker_count = 0;
+
+  if (jobs_state.start) SDL_DestroySemaphore(jobs_state.start);
+  if (jobs_state.done ) SDL_DestroySemaphore(jobs_state.done);
+}
+
+static void jobs_parallel_for(size_t count, size_t batch, jobs_Fn fn, void *data) {
+  if (batch == 0) batch = 1;
+
+  /* no point waking anyone up for one batch */
+  size_t batch_count = (count + batch - 1) / batch;
+  if (batch_count <= 1 || jobs_state.worker_count == 0) {
+    if (count > 0) fn(data, 0, count);
+    return;
+  }
+
+  /* the calling thread takes a batch too */
+  int wake = jobs_state.worker_count;
+  if (batch_count - 1 < (size_t)wake) wake = batch_count - 1;
+
+  jobs_state.fn = fn;
+  jobs_state.data = data;
+  jobs_state.count = count;
+  jobs_state.batch = batch;
+  SDL_SetAtomicInt(&jobs_state.next, 0);
+
+  for (int i = 0; i < wake; i++) SDL_SignalSemaphore(jobs_state.start);
+  jobs_run_batches();
+  for (int i = 0; i < wake; i++) SDL_WaitSemaphore(jobs_state.done);
+}
+
+#endif
@@ -0,0 +1,259 @@
+// vim: sw=2 ts=2 expandtab smartindent
+#ifndef log_IMPLEMENTATION
+
+/* Logging that's cheap enough to leave in hot paths.
+ *
+ * log_info("hi %d", 3) formats into a slot of a lock-free ring buffer
+ * (many threads can push at once) and a background thread hands it off
+ * to SDL_LogMessage later, so the caller never waits on console I/O.
+ *
+ *  - levels below log_MIN_LEVEL compile to nothing (-Dlog_MIN_LEVEL=0 for debug logs)
+ *  - each call site only gets log_SITE_MAX_PER_SEC messages through per second;
+ *    the next one that makes it through says how many were suppressed
+ *  - if the ring is full, messages are dropped and counted, never waited on
+ *  - messages longer than a slot skip the ring and are written right away
+ */
+
+#define log_LEVEL_DEBUG 0
+#define log_LEVEL_INFO  1
+#define log_LEVEL_WARN  2
+#define log_LEVEL_ERROR 3
+
+#ifndef log_MIN_LEVEL
+#define log_MIN_LEVEL log_LEVEL_INFO
+#endif
+
+#define log_SITE_MAX_PER_SEC 4
+
+/* one per call site, lives in a static in the macro below */
+typedef struct {
+  SDL_AtomicU32 second;
+  SDL_AtomicInt count, suppressed;
+} log_Site;
+
+#define log_AT(level, ...) do {                \
+    static log_Site log_site_;                 \
+    log_push(&log_site_, (level), __VA_ARGS__); \
+  } while (0)
+
+#if log_MIN_LEVEL <= log_LEVEL_DEBUG
+  #define log_debug(...) log_AT(log_LEVEL_DEBUG, __VA_ARGS__)
+#else
+  #define log_debug(...) ((void)0)
+#endif
+
+#if log_MIN_LEVEL <= log_LEVEL_INFO
+  #define log_info(...) log_AT(log_LEVEL_INFO, __VA_ARGS__)
+#else
+  #define log_info(...) ((void)0)
+#endif
+
+#if log_MIN_LEVEL <= log_LEVEL_WARN
+  #define log_warn(...) log_AT(log_LEVEL_WARN, __VA_ARGS__)
+#else
+  #define log_warn(...) ((void)0)
+#endif
+
+#define log_error(...) log_AT(log_LEVEL_ERROR, __VA_ARGS__)
+
+static void log_push(log_Site *site, int level, const char *fmt, ...);
+
+/* start/stop the thread that flushes the ring. before log_init and
+ * after log_quit, messages go straight to SDL_LogMessage instead */
+static void log_init(void);
+static void log_quit(void);
+#endif
+
+#ifdef log_IMPLEMENTATION
+
+#define log_MSG_LEN 256
+/* must be a power of two */
+#define log_RING_SIZE 256
+#define log_FLUSH_MS 50
+
+typedef struct {
+  /* Vyukov's bounded queue: seq == pos means free for the producer at pos,
+   * seq == pos+1 means written and ready for the consumer at pos */
+  SDL_AtomicU32 seq;
+  int level;
+  char text[log_MSG_LEN];
+} log_Msg;
+
+static struct {
+  log_Msg ring[log_RING_SIZE];
+  SDL_AtomicU32 write;
+  /* only touched by whoever is flushing */
+  uint32_t read;
+
+  SDL_AtomicInt dropped;
+
+  bool running;
+  SDL_AtomicInt quit;
+  SDL_Thread *thread;
+  SDL_Semaphore *wake;
+} log_state;
+
+static SDL_LogPriority log_priority(int level) {
+  switch (level) {
+    case log_LEVEL_DEBUG: return SDL_LOG_PRIORITY_DEBUG;
+    case log_LEVEL_INFO:  return SDL_LOG_PRIORITY_INFO;
+    case log_LEVEL_WARN:  return SDL_LOG_PRIORITY_WARN;
+    default:              return SDL_LOG_PRIORITY_ERROR;
+  }
+}
+
+/* returns false if this site has had its share this second */
+static bool log_site_allow(log_Site *site, int *suppressed) {
+  uint32_t now = SDL_GetTicks() / 1000;
+  uint32_t second = SDL_GetAtomicU32(&site->second);
+
+  /* whoever wins the swap starts the new second (racy but only by a message or two) */
+  if (second != now && SDL_CompareAndSwapAtomicU32(&site->second, second, now))
+    SDL_SetAtomicInt(&site->count, 0);
+
+  if (SDL_AddAtomicInt(&site->count, 1) >= log_SITE_MAX_PER_SEC) {
+    SDL_AddAtomicInt(&site->suppressed, 1);
+    return false;
+  }
+
+  *suppressed = SDL_SetAtomicInt(&site->suppressed, 0);
+  return true;
+}
+
+/* drops the trailing newlines the old logs liked (SDL_LogMessage adds its own) */
+static int log_trim(char *text, int len) {
+  while (len > 0 && text[len - 1] == '\n') text[--len] = '\0';
+  return len;
+}
+
+/* returns false if the message didn't fit in log_MSG_LEN */
+static bool log_format(char *text, int suppressed, const char *fmt, va_list args) {
+  int len = SDL_vsnprintf(text, log_MSG_LEN, fmt, args);
+  if (len < 0) len = 0;
+  bool fits = len < log_MSG_LEN;
+  if (!fits) len = log_MSG_LEN - 1;
+
+  len = log_trim(text, len);
+  if (suppressed > 0)
+    SDL_snprintf(text + len, log_MSG_LEN - len, " (%d more suppressed)", suppressed);
+  return fits;
+}
+
+static void log_push(log_Site *site, int level, const char *fmt, ...) {
+  int suppressed;
+  if (!log_site_allow(site, &suppressed)) return;
+
+  va_list args, again;
+  va_start(args, fmt);
+  va_copy(again, args);
+  char text[log_MSG_LEN];
+  bool fits = log_format(text, suppressed, fmt, args);
+  va_end(args);
+
+  /* Too long for a slot (a shader's info log, say): rather than cut it
+   * off, it goes straight to SDL_LogMessage, so it can come out ahead
+   * of messages still in the ring. */
+  char *whole = NULL;
+  if (!fits && SDL_vasprintf(&whole, fmt, again) >= 0) {
+    log_trim(whole, (int)SDL_strlen(whole));
+    if (suppressed > 0)
+      SDL_LogMessage(SDL_LOG_CATEGORY_APPLICATION, log_priority(level), "%s (%d more suppressed)", whole, suppressed);
+    else
+      SDL_LogMessage(SDL_LOG_CATEGORY_APPLICATION, log_priority(level), "%s", whole);
+    SDL_free(whole);
+  }
+  va_end(again);
+  if (whole) return;
+
+  if (!log_state.running) {
+    SDL_LogMessage(SDL_LOG_CATEGORY_APPLICATION, log_priority(level), "%s", text);
+    return;
+  }
+
+  /* claim a slot */
+  log_Msg *msg;
+  uint32_t pos = SDL_GetAtomicU32(&log_state.write);
+  for (;;) {
+    msg = log_state.ring + (pos & (log_RING_SIZE - 1));
+    int32_t diff = (int32_t)(SDL_GetAtomicU32(&msg->seq) - pos);
+
+    if (diff == 0) {
+      if (SDL_CompareAndSwapAtomicU32(&log_state.write, pos, pos + 1)) break;
+    } else if (diff < 0) {
+      /* full; the flush thread is behind */
+      SDL_AddAtomicInt(&log_state.dropped, 1);
+      return;
+    }
+
+    pos = SDL_GetAtomicU32(&log_state.write);
+  }
+
+  msg->level = level;
+  SDL_memcpy(msg->text, text, sizeof(text));
+
+  /* publish */
+  SDL_SetAtomicU32(&msg->seq, pos + 1);
+
+  /* errors are often followed by the program going away, get them out now */
+  if (level >= log_LEVEL_ERROR) SDL_SignalSemaphore(log_state.wake);
+}
+
+/* only ever called from one thread at a time */
+static void log_flush(void) {
+  for (;;) {
+    log_Msg *msg = log_state.ring + (log_state.read & (log_RING_SIZE - 1));
+    if (SDL_GetAtomicU32(&msg->seq) != log_state.read + 1) break;
+
+    SDL_LogMessage(SDL_LOG_CATEGORY_APPLICATION, log_priority(msg->level), "%s", msg->text);
+
+    /* hand it back to the producers, one lap later */
+    SDL_SetAtomicU32(&msg->seq, log_state.read + log_RING_SIZE);
+    log_state.read++;
+  }
+
+  int dropped = SDL_SetAtomicInt(&log_state.dropped, 0);
+  if (dropped > 0) SDL_Log("log: ring was full, dropped %d messages", dropped);
+}
+
+static int log_thread(void *data) {
+  while (!SDL_GetAtomicInt(&log_state.quit)) {
+    SDL_WaitSemaphoreTimeout(log_state.wake, log_FLUSH_MS);
+    log_flush();
+  }
+  return 0;
+}
+
+static void log_init(void) {
+  for (uint32_t i = 0; i < log_RING_SIZE; i++)
+    SDL_SetAtomicU32(&log_state.ring[i].seq, i);
+  SDL_SetAtomicU32(&log_state.write, 0);
+  log_state.read = 0;
+
+  log_state.wake = SDL_CreateSemaphore(0);
+  log_state.thread = SDL_CreateThread(log_thread, "log", NULL);
+
+  /* no thread, no ring; everything just goes straight through */
+  if (log_state.wake == NULL || log_state.thread == NULL) {
+    SDL_Log("log: couldn't start flush thread: %s", SDL_GetError());
+    if (log_state.wake) SDL_DestroySemaphore(log_state.wake);
+    return;
+  }
+
+  log_state.running = true;
+}
+
+static void log_quit(void) {
+  if (!log_state.running) return;
+
+  SDL_SetAtomicInt(&log_state.quit, 1);
+  SDL_SignalSemaphore(log_state.wake);
+  SDL_WaitThread(log_state.thread, NULL);
+
+  /* anything pushed after the thread's last pass */
+  log_flush();
+  log_state.running = false;
+
+  SDL_DestroySemaphore(log_state.wake);
+}
+
+#endif
@@ -14,6 +14,7 @@
 #define BREAKPOINT() __builtin_debugtrap()
 #define jx_COUNT(arr) (sizeof(arr) / sizeof((arr)[0]))
 
+#include "log.h"
 #include "math.h"
 
 #define CLAY_IMPLEMENTATION
@@ -38,6 +39,10 @@ typedef enum {
 
 #include "geometry_assets.h"
 #include "anim.h"
+#include "jobs.h"
+#include "blend.h"
+#include "character.h"
+#include "nav.h"
 
 static struct {
   struct {
@@ -82,12 +87,11 @@ static struct {
   /* sim, short for "simulation," stores things related to the
    * gameplay, physics and combat. */
   struct {
-    struct {
-      f2 pos;
+    /* the player is characters.all[0] */
+    character_State characters;
 
-      float heading_from_rads, heading_to_rads;
-      double heading_from_ts, heading_to_ts;
-    } player;
+    /* which way everyone goes to get to the player */
+    nav_State nav;
 
   } sim;
 
@@ -103,6 +107,10 @@ static struct {
   .win_size_y = 450,
   .gui_scale = 0.7f,
 
+  .cad.posts.chunk_size = sizeof(cad_PostChunk),
+  .cad.walls.chunk_size = sizeof(cad_WallChunk),
+  .cad.rooms.chunk_size = sizeof(cad_RoomChunk),
+
   .gl.pp.current_aa = gl_AntiAliasingApproach_4XSSAA,
   .gl.camera.fov = 100.0f,
   .gl.camera.dist = 5.0f,
@@ -123,20 +131,30 @@ static struct {
 /* these are useful for rendering, picking etc. */
 static f3 jeux_world_to_screen(f3 p) {
   p = f4x4_transform_f3(jeux.camera, p);
-  p = f4x4_transform_f3(f4x4_invert(jeux.screen), p);
+  p = f4x4_transform_f3(f4x4_invert_ortho(jeux.screen), p);
   return p;
 }
+/* for the output of f4x4_transform_f3_array(jeux.camera, ...) and friends */
+static void jeux_clip_to_screen_array(f3 *p, size_t n) {
+  f4x4 m = f4x4_invert_ortho(jeux.screen);
+  for (size_t i = 0; i < n; i++) {
+    p[i].x = p[i].x*m.arr[0][0] + m.arr[3][0];
+    p[i].y = p[i].y*m.arr[1][1] + m.arr[3][1];
+    p[i].z = p[i].z*m.arr[2][2] + m.arr[3][2];
+  }
+}
 static f3 jeux_screen_to_world(f3 p) {
   p = f4x4_transform_f3(jeux.screen, p);
+  /* the projection makes this the one that needs a full f4x4_invert */
   p = f4x4_transform_f3(f4x4_invert(jeux.camera), p);
   return p;
 }
 static f3 jeux_screen_to_ui(f3 p) {
   p = f4x4_transform_f3(jeux.screen, p);
-  p = f4x4_transform_f3(f4x4_invert(jeux.ui_transform), p);
+  p = f4x4_transform_f3(f4x4_invert_ortho(jeux.ui_transform), p);
   return p;
 }
-static f3 jeux_ui_to_viewport(f3 p) {
+static UNUSED_FN f3 jeux_ui_to_viewport(f3 p) {
   float size_x = jeux.gl.pp.phys_win_size_x*jeux.gl.pp.fb_scale;
   float size_y = jeux.gl.pp.phys_win_size_y*jeux.gl.pp.fb_scale;
   f4x4 viewport = f4x4_ortho(
@@ -145,11 +163,13 @@ static f3 jeux_ui_to_viewport(f3 p) {
     -1.0f,  1.0f
   );
   p = f4x4_transform_f3(jeux.ui_transform, p);
-  p = f4x4_transform_f3(f4x4_invert(viewport), p);
+  p = f4x4_transform_f3(f4x4_invert_ortho(viewport), p);
   return p;
 }
 
 SDL_AppResult SDL_AppInit(void **appstate, int argc, char **argv) {
+  log_init();
+  jobs_init();
 
   /* sdl init */
   {
@@ -158,7 +178,7 @@ SDL_AppResult SDL_AppInit(void **appstate, int argc, char **argv) {
     SDL_SetHint(SDL_HINT_VIDEO_FORCE_EGL, "1");
 
     if (!SDL_Init(SDL_INIT_VIDEO)) {
-      SDL_Log("SDL init failed: %s\n", SDL_GetError());
+      log_error("SDL init failed: %s", SDL_GetError());
       return 1;
     }
 
@@ -179,13 +199,13 @@ SDL_AppResult SDL_AppInit(void **appstate, int argc, char **argv) {
       SDL_WINDOW_OPENGL | SDL_WINDOW_RESIZABLE | SDL_WINDOW_HIGH_PIXEL_DENSITY
     );
     if (jeux.sdl.window == NULL) {
-      SDL_Log("Window init failed: %s\n", SDL_GetError());
+      log_error("Window init failed: %s", SDL_GetError());
       return 1;
     }
 
     jeux.sdl.gl_ctx = SDL_GL_CreateContext(jeux.sdl.window);
     if (jeux.sdl.window == NULL) {
-      SDL_Log("GL init failed: %s\n", SDL_GetError());
+      log_error("GL init failed: %s", SDL_GetError());
       return 1;
     }
 
@@ -210,6 +230,15 @@ SDL_AppResult SDL_AppInit(void **appstate, int argc, char **argv) {
    * ui matrix thingy is initialized */
   gui_init();
 
+  /* the player */
+  character_spawn((f2) { 0.0f, 0.0f }, 0.0f);
+
+  nav_init();
+
+  /* the player's base - after gl, since it gets meshed as it's loaded,
+   * and after nav, since it has to go around it */
+  cad_init();
+
   return SDL_APP_CONTINUE;
 }
 
@@ -218,6 +247,9 @@ SDL_AppResult SDL_AppEvent(void *appstate, SDL_Event *event) {
   {
     if (event->type == SDL_EVENT_QUIT) return SDL_APP_SUCCESS;
 
+    /* e.g. dragged onto a monitor with a different density; the UI atlas needs redoing too */
+    if (event->type == SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED) gl_resize();
+
     if (event->type == SDL_EVENT_WINDOW_RESIZED) {
       jeux.win_size_x = event->window.data1;
       jeux.win_size_y = event->window.data2;
@@ -284,8 +316,11 @@ SDL_AppResult SDL_AppEvent(void *appstate, SDL_Event *event) {
 }
 
 void SDL_AppQuit(void *appstate, SDL_AppResult result) {
+  cad_quit();
   SDL_GL_DestroyContext(jeux.sdl.gl_ctx);
   SDL_DestroyWindow(jeux.sdl.window);
+  jobs_quit();
+  log_quit();
 }
 
 SDL_AppResult SDL_AppIterate(void *appstate) {
@@ -340,7 +375,7 @@ SDL_AppResult SDL_AppIterate(void *appstate) {
         (f3) { 0.0f, 0.0f, 1.0f },
         (f3) { 0.0f, 0.0f, 1.0f }
       );
-      jeux.camera = f4x4_mul_f4x4(projection, f4x4_invert(orbit));
+      jeux.camera = f4x4_mul_affine(projection, f4x4_invert_affine(orbit));
     }
 
 
@@ -362,26 +397,27 @@ SDL_AppResult SDL_AppIterate(void *appstate) {
 
     /* MARK: draw ui */
     {
-      Clay_RenderCommandArray cmds;
-
-      /* Because of my proclivity towards using Clay_Hovered() instead of
-       * Clay_OnHover (because I think the callback is ugly), we have
-       * to layout 3 times/frame to prevent there from being any instability */
-      for (int i = 0; i < 3; i++) {
-        Clay_SetPointerState(
-          (Clay_Vector2) { jeux.mouse_ui_x, jeux.mouse_ui_y },
-          jeux.raw_mouse_lmb_down
-        );
+      /* applies things like ui scale changes that would
+       * invalidate the layout if they happened mid-frame */
+      gui_frame_begin();
+
+      /* Clay_SetPointerState hit tests against the bounding boxes from
+       * the previous frame's layout, so everything Clay_Hovered() says in
+       * gui_frame is resolved against what the user actually saw (and
+       * clicked on) last frame. One layout per frame is all we need. */
+      Clay_SetPointerState(
+        (Clay_Vector2) { jeux.mouse_ui_x, jeux.mouse_ui_y },
+        jeux.raw_mouse_lmb_down
+      );
 
-        Clay_BeginLayout();
+      Clay_BeginLayout();
 
-        gui_frame();
+      gui_frame();
 
-        cmds = Clay_EndLayout();
-      }
+      Clay_RenderCommandArray cmds = Clay_EndLayout();
 
       jeux.mouse_lmb_down = false;
-      SDL_Log("mouse_capture = %d", (int)jeux.gui.capture_mouse);
+      log_debug("mouse_capture = %d", (int)jeux.gui.capture_mouse);
       if (!jeux.gui.capture_mouse) {
         jeux.mouse_lmb_down = jeux.raw_mouse_lmb_down;
       }
@@ -416,7 +452,7 @@ SDL_AppResult SDL_AppIterate(void *appstate) {
         /* draw a ring where we think the mouse is in 3D space
          * (useful to compare to its 2D position) */
         gl_geo_ring3(
-          32,
+          gl_geo_DETAIL_AUTO,
           jeux.mouse_ground,
           0.2f,
           debug_thickness,
@@ -455,107 +491,11 @@ SDL_AppResult SDL_AppIterate(void *appstate) {
     /* draw player-constructed geometry */
     cad_frame();
 
-    /* draw figure */
-    if (1) {
-      animdata_Frame *turn_frames;
-      size_t turn_frame_count;
-      float turn_anim_duration;
-
-      bool left = rads_distance(jeux.sim.player.heading_from_rads, jeux.sim.player.heading_to_rads) < 0;
-
-      if (left) {
-        turn_frames = animdata_turn90_left_frames;
-        turn_frame_count = jx_COUNT(animdata_turn90_left_frames);
-        turn_anim_duration = animdata_turn90_left_duration;
-      } else {
-        turn_frames = animdata_turn90_right_frames;
-        turn_frame_count = jx_COUNT(animdata_turn90_right_frames);
-        turn_anim_duration = animdata_turn90_right_duration;
-      }
-
-      animdata_Frame *walk_frames = animdata_walk_frames;
-      size_t walk_frame_count = jx_COUNT(animdata_walk_frames);
-      float walk_anim_duration = animdata_walk_duration;
-
-      f4x4 model = f4x4_scale(1.0f);
-
-      /* here we figure out progress for the turn animation,
-       * and fade out either end of it via return_anim_t */
-      float turn_anim_t, return_anim_t;
-      {
-        float turn_t = clamp(0, 1, inv_lerp(
-          jeux.sim.player.heading_from_ts,
-          jeux.sim.player.heading_to_ts,
-          jeux.elapsed
-        ));
-
-        /* as you go from (1 - ((n - 1)/n)) going to 1 it starts to wrap back around to the first frame */
-        float loopless_duration = turn_anim_duration * (((float)turn_frame_count - 1.0f) / (float)turn_frame_count);
-        turn_anim_t = turn_t * loopless_duration;
-        float turn_anim_begin_t  = clamp(0, 1, inv_lerp(loopless_duration*0.3,                 0, turn_anim_t));
-        float turn_anim_finish_t = clamp(0, 1, inv_lerp(loopless_duration*0.7, loopless_duration, turn_anim_t));
-        return_anim_t = fmaxf(turn_anim_begin_t, turn_anim_finish_t);
-        float return_t = clamp(0, 1, return_anim_t / loopless_duration);
-
-        model = f4x4_mul_f4x4(model, f4x4_turn(-rads_lerp(
-            jeux.sim.player.heading_from_rads,
-            jeux.sim.player.heading_to_rads,
-            turn_t
-        ) + M_PI*0.5f*turn_t*(left ? -1 : 1)*(1.0f - return_t) ));
-      }
+    /* find the way around whatever was built */
+    nav_frame();
 
-      /* figure out the positions of all the joints for this frame */
-      f3 joint_pos[animdata_JointKey_COUNT] = {0};
-      {
-        for (int joint_i = 0; joint_i < animdata_JointKey_COUNT; joint_i++) {
-          float walk_anim_t = fmod(jeux.elapsed, (double)walk_anim_duration);
-          f3 walk = animdata_sample(walk_frames, walk_frame_count, walk_anim_duration, joint_i, walk_anim_t);
-          f3 turn = animdata_sample(turn_frames, turn_frame_count, turn_anim_duration, joint_i, turn_anim_t);
-          joint_pos[joint_i] = f3_lerp(
-            turn,
-            walk,
-            return_anim_t
-          );
-        }
-      }
-
-      /* draw lines between connected joints */
-      for (int i = 0; i < jx_COUNT(animdata_limb_connections); i++) {
-        animdata_JointKey from = animdata_limb_connections[i].from,
-                            to = animdata_limb_connections[i].to;
-        f3 a = jeux_world_to_screen(f4x4_transform_f3(model, joint_pos[from]));
-        f3 b = jeux_world_to_screen(f4x4_transform_f3(model, joint_pos[  to]));
-
-        float thickness = jeux.win_size_x * 0.006f;
-
-        Color color = { 1, 1, 1, 255 };
-        gl_geo_line(a, b, thickness, color);
-
-        gl_geo_circle(8, a, thickness * 0.5f, color);
-        gl_geo_circle(8, b, thickness * 0.5f, color);
-      }
-
-      /* draw head */
-      {
-        f3 head = joint_pos[animdata_JointKey_Head];
-
-        /* head assets are 2x2x2 centered around (0, 0, 0) */
-        float radius = 0.175f;
-
-        /* if this is 0.8f, a perfectly (0, 0, 1) aligned neck will penetrate 20% */
-        head.z += radius*0.8f;
-
-        f4x4 matrix = model;
-        matrix = f4x4_mul_f4x4(matrix, f4x4_move(head));
-        /* the animations seem to be exported with the negative X axis as "forward," so ... */
-        matrix = f4x4_mul_f4x4(matrix, f4x4_turn(-M_PI * 0.5f));
-        matrix = f4x4_mul_f4x4(matrix, f4x4_scale(radius));
-
-        *jeux.gl.geo.model_draws_wtr++ = (gl_ModelDraw) { .model = gl_Model_Head, .matrix = matrix };
-        *jeux.gl.geo.model_draws_wtr++ = (gl_ModelDraw) { .model = gl_Model_HornedHelmet, .matrix = matrix };
-      }
-
-    }
+    /* animate and draw everyone */
+    character_frame();
 
     if (0) gl_text_draw(
       "hi! i'm ced?",
@@ -574,11 +514,26 @@ SDL_AppResult SDL_AppIterate(void *appstate) {
   return SDL_APP_CONTINUE;
 }
 
+#define log_IMPLEMENTATION
+#include "log.h"
+
+#define jobs_IMPLEMENTATION
+#include "jobs.h"
+
+#define blend_IMPLEMENTATION
+#include "blend.h"
+
+#define character_IMPLEMENTATION
+#include "character.h"
+
 #define gui_IMPLEMENTATION
 #include "gui.h"
 
 #define cad_IMPLEMENTATION
 #include "cad.h"
 
+#define nav_IMPLEMENTATION
+#include "nav.h"
+
 #define gl_IMPLEMENTATION
 #include "gl.h"
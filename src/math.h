@@ -1,5 +1,17 @@
 // vim: sw=2 ts=2 expandtab smartindent
 
+/* The f4x4 hot paths (mul, mul_affine, mul_f4, transform and the transform
+ * arrays) have SSE2 and NEON versions, and invert has an SSE2 one; they're
+ * picked at compile time from what the target has. Build with -Dmath_NO_SIMD
+ * to get the plain C versions everywhere (tools/math_check.c compares the two). */
+#if !defined(math_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64))
+  #define math_SSE2 1
+  #include <emmintrin.h>
+#elif !defined(math_NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+  #define math_NEON 1
+  #include <arm_neon.h>
+#endif
+
 typedef struct { float x, y; } f2;
 typedef struct { float x, y, z; } f3;
 typedef union { float arr[4]; struct { float x, y, z, w; } p; f3 xyz; } f4;
@@ -25,13 +37,21 @@ static f2 f2_norm(f2 f) {
   float len = f2_length(f);
   return (f2) { f.x / len, f.y / len };
 }
+/* how far p is from the closest point on the segment a b */
+static float f2_segment_distance(f2 p, f2 a, f2 b) {
+  f2 ab = { b.x - a.x, b.y - a.y };
+  float len2 = ab.x*ab.x + ab.y*ab.y;
+  float t = (len2 > 0) ? clamp(0, 1, ((p.x - a.x)*ab.x + (p.y - a.y)*ab.y) / len2) : 0;
+  return f2_length((f2) { a.x + ab.x*t - p.x, a.y + ab.y*t - p.y });
+}
 static bool f2_line_hits_line(f2 from0, f2 to0, f2 from1, f2 to1, f2 *out) {
   float a = from0.x, b = from0.y,
         c =   to0.x, d =   to0.y,
         p = from1.x, q = from1.y,
         r =   to1.x, s =   to1.y;
   float det = (c - a) * (s - q) - (r - p) * (d - b);
-  if (det < 0.001) {
+  /* (parallel, or close enough) */
+  if (fabsf(det) < 0.001f) {
     return false;
   } else {
     float lambda = ((s - q) * (r - a) + (p - r) * (s - b)) / det;
@@ -47,7 +67,27 @@ static bool f2_line_hits_line(f2 from0, f2 to0, f2 from1, f2 to1, f2 *out) {
   }
 }
 
-static f3 f3_lerp(f3 a, f3 b, float t) {
+/* Walks the detail + 1 points of an arc around the unit circle. Each point is
+ * the last one rotated by the step, so the whole arc costs two sin/cos pairs
+ * rather than one per point (the drift is nowhere near a pixel at our details). */
+typedef struct { f2 p; float step_cos, step_sin; } math_ArcWalk;
+
+static math_ArcWalk math_arc_walk(float radians_from, float radians_to, size_t detail) {
+  float step = (radians_to - radians_from) / (float)detail;
+  return (math_ArcWalk) {
+    .p = { cosf(radians_from), sinf(radians_from) },
+    .step_cos = cosf(step),
+    .step_sin = sinf(step),
+  };
+}
+
+static void math_arc_step(math_ArcWalk *walk) {
+  f2 p = walk->p;
+  walk->p.x = p.x*walk->step_cos - p.y*walk->step_sin;
+  walk->p.y = p.x*walk->step_sin + p.y*walk->step_cos;
+}
+
+static UNUSED_FN f3 f3_lerp(f3 a, f3 b, float t) {
   return (f3) {
     .x = lerp(a.x, b.x, t),
     .y = lerp(a.y, b.y, t),
@@ -152,7 +192,84 @@ static f4x4 f4x4_target_to(f3 eye, f3 target, f3 up) {
   } };
 }
 
+#if math_SSE2
+/* 2x2 matrices packed into one register, for f4x4_invert: (a b c d) is | a b |
+ *                                                                      | c d | */
+#define math_SHUFFLE(a, b, x, y, z, w) _mm_shuffle_ps((a), (b), _MM_SHUFFLE((w), (z), (y), (x)))
+#define math_SWIZZLE(a, x, y, z, w) math_SHUFFLE(a, a, x, y, z, w)
+
+/* a*b */
+static __m128 math_mat2_mul(__m128 a, __m128 b) {
+  return _mm_add_ps(_mm_mul_ps(                   a,           math_SWIZZLE(b, 0, 3, 0, 3)),
+                    _mm_mul_ps(math_SWIZZLE(a, 1, 0, 3, 2), math_SWIZZLE(b, 2, 1, 2, 1)));
+}
+/* adjugate(a)*b */
+static __m128 math_mat2_adj_mul(__m128 a, __m128 b) {
+  return _mm_sub_ps(_mm_mul_ps(math_SWIZZLE(a, 3, 3, 0, 0),                           b),
+                    _mm_mul_ps(math_SWIZZLE(a, 1, 1, 2, 2), math_SWIZZLE(b, 2, 3, 0, 1)));
+}
+/* a*adjugate(b) */
+static __m128 math_mat2_mul_adj(__m128 a, __m128 b) {
+  return _mm_sub_ps(_mm_mul_ps(                   a,           math_SWIZZLE(b, 3, 0, 3, 0)),
+                    _mm_mul_ps(math_SWIZZLE(a, 1, 0, 3, 2), math_SWIZZLE(b, 2, 1, 2, 1)));
+}
+#endif
+
 static f4x4 f4x4_invert(f4x4 a) {
+#if math_SSE2
+    /* Blockwise: split the matrix into 2x2s | A B | and invert in terms of those.
+     *                                        | C D |
+     * (the inverse of the transpose is the transpose of the inverse, so it
+     * doesn't matter that our columns are being treated as rows here) */
+    __m128 r0 = _mm_loadu_ps(a.rows[0].arr), r1 = _mm_loadu_ps(a.rows[1].arr),
+           r2 = _mm_loadu_ps(a.rows[2].arr), r3 = _mm_loadu_ps(a.rows[3].arr);
+
+    __m128 A = _mm_movelh_ps(r0, r1), B = _mm_movehl_ps(r1, r0);
+    __m128 C = _mm_movelh_ps(r2, r3), D = _mm_movehl_ps(r3, r2);
+
+    /* (|A| |B| |C| |D|) */
+    __m128 det_sub = _mm_sub_ps(
+      _mm_mul_ps(math_SHUFFLE(r0, r2, 0, 2, 0, 2), math_SHUFFLE(r1, r3, 1, 3, 1, 3)),
+      _mm_mul_ps(math_SHUFFLE(r0, r2, 1, 3, 1, 3), math_SHUFFLE(r1, r3, 0, 2, 0, 2))
+    );
+    __m128 det_a = math_SWIZZLE(det_sub, 0, 0, 0, 0), det_b = math_SWIZZLE(det_sub, 1, 1, 1, 1);
+    __m128 det_c = math_SWIZZLE(det_sub, 2, 2, 2, 2), det_d = math_SWIZZLE(det_sub, 3, 3, 3, 3);
+
+    __m128 d_c = math_mat2_adj_mul(D, C);
+    __m128 a_b = math_mat2_adj_mul(A, B);
+
+    /* the inverse is | X Y | / |M|, these are the adjugates of each of those */
+    /*                | Z W |                                                  */
+    __m128 x = _mm_sub_ps(_mm_mul_ps(det_d, A), math_mat2_mul(B, d_c));
+    __m128 w = _mm_sub_ps(_mm_mul_ps(det_a, D), math_mat2_mul(C, a_b));
+    __m128 y = _mm_sub_ps(_mm_mul_ps(det_b, C), math_mat2_mul_adj(D, a_b));
+    __m128 z = _mm_sub_ps(_mm_mul_ps(det_c, B), math_mat2_mul_adj(A, d_c));
+
+    /* |M| = |A||D| + |B||C| - tr((A#B)(D#C)) */
+    __m128 tr = _mm_mul_ps(a_b, math_SWIZZLE(d_c, 0, 2, 1, 3));
+    tr = _mm_add_ps(tr, math_SWIZZLE(tr, 2, 3, 0, 1));
+    tr = _mm_add_ps(tr, math_SWIZZLE(tr, 1, 0, 3, 2));
+    __m128 det = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(det_a, det_d), _mm_mul_ps(det_b, det_c)), tr);
+
+    if (_mm_cvtss_f32(det) == 0.0f) {
+      log_warn("Couldn't invert matrix!");
+      return (f4x4) {0};
+    }
+
+    /* the sign flips turn each adjugate back into its 2x2 */
+    __m128 rdet = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det);
+    x = _mm_mul_ps(x, rdet);
+    y = _mm_mul_ps(y, rdet);
+    z = _mm_mul_ps(z, rdet);
+    w = _mm_mul_ps(w, rdet);
+
+    f4x4 out;
+    _mm_storeu_ps(out.rows[0].arr, math_SHUFFLE(x, y, 3, 1, 3, 1));
+    _mm_storeu_ps(out.rows[1].arr, math_SHUFFLE(x, y, 2, 0, 2, 0));
+    _mm_storeu_ps(out.rows[2].arr, math_SHUFFLE(z, w, 3, 1, 3, 1));
+    _mm_storeu_ps(out.rows[3].arr, math_SHUFFLE(z, w, 2, 0, 2, 0));
+    return out;
+#else
     float b00 = a.arr[0][0] * a.arr[1][1] - a.arr[0][1] * a.arr[1][0];
     float b01 = a.arr[0][0] * a.arr[1][2] - a.arr[0][2] * a.arr[1][0];
     float b02 = a.arr[0][0] * a.arr[1][3] - a.arr[0][3] * a.arr[1][0];
@@ -169,7 +286,7 @@ static f4x4 f4x4_invert(f4x4 a) {
     /* Calculate the determinant */
     float det = b00 * b11 - b01 * b10 + b02 * b09 + b03 * b08 - b04 * b07 + b05 * b06;
     if (det == 0.0f) {
-      SDL_Log("Couldn't invert matrix!\n");
+      log_warn("Couldn't invert matrix!");
       return (f4x4) {0};
     }
 
@@ -192,11 +309,82 @@ static f4x4 f4x4_invert(f4x4 a) {
       (a.arr[3][1] * b01 - a.arr[3][0] * b03 - a.arr[3][2] * b00) * det,
       (a.arr[2][0] * b03 - a.arr[2][1] * b01 + a.arr[2][2] * b00) * det,
     } };
+#endif
+}
+
+/* For when the matrix has a bottom row of 0 0 0 1, i.e. it's only
+ * f4x4_move/turn/scale3 etc. multiplied together; far cheaper than f4x4_invert */
+static f4x4 f4x4_invert_affine(f4x4 a) {
+  f3 c0 = a.rows[0].xyz, c1 = a.rows[1].xyz, c2 = a.rows[2].xyz, t = a.rows[3].xyz;
+
+  /* the rows of the inverse of the upper 3x3 are the cross products of its columns */
+  f3 r0 = { c1.y*c2.z - c1.z*c2.y, c1.z*c2.x - c1.x*c2.z, c1.x*c2.y - c1.y*c2.x };
+  f3 r1 = { c2.y*c0.z - c2.z*c0.y, c2.z*c0.x - c2.x*c0.z, c2.x*c0.y - c2.y*c0.x };
+  f3 r2 = { c0.y*c1.z - c0.z*c1.y, c0.z*c1.x - c0.x*c1.z, c0.x*c1.y - c0.y*c1.x };
+
+  float det = c0.x*r0.x + c0.y*r0.y + c0.z*r0.z;
+  if (det == 0.0f) {
+    log_warn("Couldn't invert matrix!");
+    return (f4x4) {0};
+  }
+  det = 1.0f / det;
+
+  return (f4x4) { .arr = {
+    { r0.x*det, r1.x*det, r2.x*det, 0.0f },
+    { r0.y*det, r1.y*det, r2.y*det, 0.0f },
+    { r0.z*det, r1.z*det, r2.z*det, 0.0f },
+    {
+      -(r0.x*t.x + r0.y*t.y + r0.z*t.z)*det,
+      -(r1.x*t.x + r1.y*t.y + r1.z*t.z)*det,
+      -(r2.x*t.x + r2.y*t.y + r2.z*t.z)*det,
+      1.0f
+    },
+  } };
 }
 
-static f4x4 f4x4_mul_f4x4(f4x4 a, f4x4 b) {
+/* For scale + translate only, like what f4x4_ortho, f4x4_scale3 and f4x4_move make */
+static f4x4 f4x4_invert_ortho(f4x4 a) {
+  f4x4 res = {0};
+  for (int i = 0; i < 3; i++) {
+    if (a.arr[i][i] == 0.0f) {
+      log_warn("Couldn't invert matrix!");
+      return (f4x4) {0};
+    }
+    res.arr[i][i] = 1.0f / a.arr[i][i];
+    res.arr[3][i] = -a.arr[3][i] * res.arr[i][i];
+  }
+  res.arr[3][3] = 1.0f;
+  return res;
+}
+
+static UNUSED_FN f4x4 f4x4_mul_f4x4(f4x4 a, f4x4 b) {
   f4x4 out = {0};
 
+#if math_SSE2
+  /* each column of out is a's columns weighted by that column of b */
+  __m128 a0 = _mm_loadu_ps(a.rows[0].arr), a1 = _mm_loadu_ps(a.rows[1].arr),
+         a2 = _mm_loadu_ps(a.rows[2].arr), a3 = _mm_loadu_ps(a.rows[3].arr);
+  for (int i = 0; i < 4; i++) {
+    __m128 col =            _mm_mul_ps(a0, _mm_set1_ps(b.arr[i][0]));
+    col = _mm_add_ps(col, _mm_mul_ps(a1, _mm_set1_ps(b.arr[i][1])));
+    col = _mm_add_ps(col, _mm_mul_ps(a2, _mm_set1_ps(b.arr[i][2])));
+    col = _mm_add_ps(col, _mm_mul_ps(a3, _mm_set1_ps(b.arr[i][3])));
+    _mm_storeu_ps(out.rows[i].arr, col);
+  }
+  return out;
+#elif math_NEON
+  float32x4_t a0 = vld1q_f32(a.rows[0].arr), a1 = vld1q_f32(a.rows[1].arr),
+              a2 = vld1q_f32(a.rows[2].arr), a3 = vld1q_f32(a.rows[3].arr);
+  for (int i = 0; i < 4; i++) {
+    float32x4_t col =       vmulq_n_f32(     a0, b.arr[i][0]);
+    col = vmlaq_n_f32(col, a1, b.arr[i][1]);
+    col = vmlaq_n_f32(col, a2, b.arr[i][2]);
+    col = vmlaq_n_f32(col, a3, b.arr[i][3]);
+    vst1q_f32(out.rows[i].arr, col);
+  }
+  return out;
+#endif
+
   /* cache only the current line of the second matrix */
   f4 bb = b.rows[0];
   out.arr[0][0] = bb.arr[0] * a.arr[0][0] + bb.arr[1] * a.arr[1][0] + bb.arr[2] * a.arr[2][0] + bb.arr[3] * a.arr[3][0];
@@ -222,8 +410,60 @@ static f4x4 f4x4_mul_f4x4(f4x4 a, f4x4 b) {
   return out;
 }
 
+/* a*b, where b's bottom row is 0 0 0 1 (a can be anything, e.g. jeux.camera),
+ * so only three columns of a need weighing, and the last column is just added */
+static f4x4 f4x4_mul_affine(f4x4 a, f4x4 b) {
+  f4x4 out;
+
+#if math_SSE2
+  __m128 a0 = _mm_loadu_ps(a.rows[0].arr), a1 = _mm_loadu_ps(a.rows[1].arr),
+         a2 = _mm_loadu_ps(a.rows[2].arr);
+  for (int i = 0; i < 4; i++) {
+    __m128 col =            _mm_mul_ps(a0, _mm_set1_ps(b.arr[i][0]));
+    col = _mm_add_ps(col, _mm_mul_ps(a1, _mm_set1_ps(b.arr[i][1])));
+    col = _mm_add_ps(col, _mm_mul_ps(a2, _mm_set1_ps(b.arr[i][2])));
+    _mm_storeu_ps(out.rows[i].arr, col);
+  }
+  _mm_storeu_ps(out.rows[3].arr, _mm_add_ps(_mm_loadu_ps(out.rows[3].arr), _mm_loadu_ps(a.rows[3].arr)));
+  return out;
+#elif math_NEON
+  float32x4_t a0 = vld1q_f32(a.rows[0].arr), a1 = vld1q_f32(a.rows[1].arr),
+              a2 = vld1q_f32(a.rows[2].arr);
+  for (int i = 0; i < 4; i++) {
+    float32x4_t col =       vmulq_n_f32(     a0, b.arr[i][0]);
+    col = vmlaq_n_f32(col, a1, b.arr[i][1]);
+    col = vmlaq_n_f32(col, a2, b.arr[i][2]);
+    vst1q_f32(out.rows[i].arr, col);
+  }
+  vst1q_f32(out.rows[3].arr, vaddq_f32(vld1q_f32(out.rows[3].arr), vld1q_f32(a.rows[3].arr)));
+  return out;
+#endif
+
+  for (int i = 0; i < 4; i++)
+    for (int x = 0; x < 4; x++)
+      out.arr[i][x] = a.arr[0][x]*b.arr[i][0] + a.arr[1][x]*b.arr[i][1] + a.arr[2][x]*b.arr[i][2];
+  for (int x = 0; x < 4; x++)
+    out.arr[3][x] += a.arr[3][x];
+  return out;
+}
+
 static f4 f4x4_mul_f4(f4x4 m, f4 v) {
   f4 res = {0};
+#if math_SSE2
+  __m128 sum =            _mm_mul_ps(_mm_loadu_ps(m.rows[0].arr), _mm_set1_ps(v.arr[0]));
+  sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(m.rows[1].arr), _mm_set1_ps(v.arr[1])));
+  sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(m.rows[2].arr), _mm_set1_ps(v.arr[2])));
+  sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(m.rows[3].arr), _mm_set1_ps(v.arr[3])));
+  _mm_storeu_ps(res.arr, sum);
+  return res;
+#elif math_NEON
+  float32x4_t sum =       vmulq_n_f32(     vld1q_f32(m.rows[0].arr), v.arr[0]);
+  sum = vmlaq_n_f32(sum, vld1q_f32(m.rows[1].arr), v.arr[1]);
+  sum = vmlaq_n_f32(sum, vld1q_f32(m.rows[2].arr), v.arr[2]);
+  sum = vmlaq_n_f32(sum, vld1q_f32(m.rows[3].arr), v.arr[3]);
+  vst1q_f32(res.arr, sum);
+  return res;
+#endif
   for (int x = 0; x < 4; x++) {
     float sum = 0;
     for (int y = 0; y < 4; y++)
@@ -244,6 +484,122 @@ static f3 f4x4_transform_f3(f4x4 m, f3 v) {
   return res.xyz;
 }
 
+/* Which of the clip planes a point is past, from the f4x4_*_array functions
+ * below (so only meaningful if the matrix ends in clip space, e.g. jeux.camera).
+ * A line whose ends are both past the same plane can't be on screen. */
+#define math_OUTSIDE_LEFT   (1 << 0)
+#define math_OUTSIDE_RIGHT  (1 << 1)
+#define math_OUTSIDE_BOTTOM (1 << 2)
+#define math_OUTSIDE_TOP    (1 << 3)
+#define math_OUTSIDE_NEAR   (1 << 4)
+#define math_OUTSIDE_FAR    (1 << 5)
+
+static uint8_t math_outcode(f4 clip) {
+  float w = clip.p.w;
+  return (clip.p.x < -w)*math_OUTSIDE_LEFT   | (clip.p.x > w)*math_OUTSIDE_RIGHT
+       | (clip.p.y < -w)*math_OUTSIDE_BOTTOM | (clip.p.y > w)*math_OUTSIDE_TOP
+       | (clip.p.z < -w)*math_OUTSIDE_NEAR   | (clip.p.z > w)*math_OUTSIDE_FAR;
+}
+
+/* f4x4_transform_f3 over n points, four at a time; "in" is n f2s or f3s
+ * ("dims" says which), the f2s being on the z = 0 plane */
+static void math_transform_array(f4x4 m, const float *in, int dims, f3 *out, uint8_t *outside, size_t n) {
+  size_t i = 0;
+
+#if math_SSE2
+  __m128 m00 = _mm_set1_ps(m.arr[0][0]), m01 = _mm_set1_ps(m.arr[0][1]), m02 = _mm_set1_ps(m.arr[0][2]), m03 = _mm_set1_ps(m.arr[0][3]);
+  __m128 m10 = _mm_set1_ps(m.arr[1][0]), m11 = _mm_set1_ps(m.arr[1][1]), m12 = _mm_set1_ps(m.arr[1][2]), m13 = _mm_set1_ps(m.arr[1][3]);
+  __m128 m20 = _mm_set1_ps(m.arr[2][0]), m21 = _mm_set1_ps(m.arr[2][1]), m22 = _mm_set1_ps(m.arr[2][2]), m23 = _mm_set1_ps(m.arr[2][3]);
+  __m128 m30 = _mm_set1_ps(m.arr[3][0]), m31 = _mm_set1_ps(m.arr[3][1]), m32 = _mm_set1_ps(m.arr[3][2]), m33 = _mm_set1_ps(m.arr[3][3]);
+
+  for (; i + 4 <= n; i += 4) {
+    /* four points into one register per axis */
+    const float *p = in + i*dims;
+    __m128 x = _mm_setr_ps(p[0], p[dims], p[dims*2], p[dims*3]);
+    __m128 y = _mm_setr_ps(p[1], p[dims + 1], p[dims*2 + 1], p[dims*3 + 1]);
+    __m128 z = (dims == 3) ? _mm_setr_ps(p[2], p[dims + 2], p[dims*2 + 2], p[dims*3 + 2]) : _mm_setzero_ps();
+
+    __m128 cx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m00), _mm_mul_ps(y, m10)), _mm_add_ps(_mm_mul_ps(z, m20), m30));
+    __m128 cy = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m01), _mm_mul_ps(y, m11)), _mm_add_ps(_mm_mul_ps(z, m21), m31));
+    __m128 cz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m02), _mm_mul_ps(y, m12)), _mm_add_ps(_mm_mul_ps(z, m22), m32));
+    __m128 cw = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m03), _mm_mul_ps(y, m13)), _mm_add_ps(_mm_mul_ps(z, m23), m33));
+
+    if (outside) {
+      __m128 neg_w = _mm_sub_ps(_mm_setzero_ps(), cw);
+      int left   = _mm_movemask_ps(_mm_cmplt_ps(cx, neg_w)), right = _mm_movemask_ps(_mm_cmpgt_ps(cx, cw));
+      int bottom = _mm_movemask_ps(_mm_cmplt_ps(cy, neg_w)), top   = _mm_movemask_ps(_mm_cmpgt_ps(cy, cw));
+      int near   = _mm_movemask_ps(_mm_cmplt_ps(cz, neg_w)), far   = _mm_movemask_ps(_mm_cmpgt_ps(cz, cw));
+      for (int l = 0; l < 4; l++)
+        outside[i + l] = ((left   >> l) & 1)*math_OUTSIDE_LEFT   | ((right >> l) & 1)*math_OUTSIDE_RIGHT
+                       | ((bottom >> l) & 1)*math_OUTSIDE_BOTTOM | ((top   >> l) & 1)*math_OUTSIDE_TOP
+                       | ((near   >> l) & 1)*math_OUTSIDE_NEAR   | ((far   >> l) & 1)*math_OUTSIDE_FAR;
+    }
+
+    __m128 rw = _mm_div_ps(_mm_set1_ps(1.0f), cw);
+    float res[3][4];
+    _mm_storeu_ps(res[0], _mm_mul_ps(cx, rw));
+    _mm_storeu_ps(res[1], _mm_mul_ps(cy, rw));
+    _mm_storeu_ps(res[2], _mm_mul_ps(cz, rw));
+    for (int l = 0; l < 4; l++) out[i + l] = (f3) { res[0][l], res[1][l], res[2][l] };
+  }
+#elif math_NEON
+  for (; i + 4 <= n; i += 4) {
+    float32x4_t x, y, z;
+    if (dims == 3) {
+      float32x4x3_t p = vld3q_f32(in + i*3);
+      x = p.val[0], y = p.val[1], z = p.val[2];
+    } else {
+      float32x4x2_t p = vld2q_f32(in + i*2);
+      x = p.val[0], y = p.val[1], z = vdupq_n_f32(0.0f);
+    }
+
+    float32x4_t cx = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m.arr[3][0]), x, m.arr[0][0]), y, m.arr[1][0]), z, m.arr[2][0]);
+    float32x4_t cy = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m.arr[3][1]), x, m.arr[0][1]), y, m.arr[1][1]), z, m.arr[2][1]);
+    float32x4_t cz = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m.arr[3][2]), x, m.arr[0][2]), y, m.arr[1][2]), z, m.arr[2][2]);
+    float32x4_t cw = vmlaq_n_f32(vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(m.arr[3][3]), x, m.arr[0][3]), y, m.arr[1][3]), z, m.arr[2][3]);
+
+    if (outside) {
+      float32x4_t neg_w = vnegq_f32(cw);
+      uint32x4_t code =          vandq_u32(vcltq_f32(cx, neg_w), vdupq_n_u32(math_OUTSIDE_LEFT));
+      code = vorrq_u32(code, vandq_u32(vcgtq_f32(cx,    cw), vdupq_n_u32(math_OUTSIDE_RIGHT)));
+      code = vorrq_u32(code, vandq_u32(vcltq_f32(cy, neg_w), vdupq_n_u32(math_OUTSIDE_BOTTOM)));
+      code = vorrq_u32(code, vandq_u32(vcgtq_f32(cy,    cw), vdupq_n_u32(math_OUTSIDE_TOP)));
+      code = vorrq_u32(code, vandq_u32(vcltq_f32(cz, neg_w), vdupq_n_u32(math_OUTSIDE_NEAR)));
+      code = vorrq_u32(code, vandq_u32(vcgtq_f32(cz,    cw), vdupq_n_u32(math_OUTSIDE_FAR)));
+      uint32_t codes[4];
+      vst1q_u32(codes, code);
+      for (int l = 0; l < 4; l++) outside[i + l] = codes[l];
+    }
+
+    /* no vdivq_f32 on 32-bit ARM, so a reciprocal estimate and two Newton steps */
+    float32x4_t rw = vrecpeq_f32(cw);
+    rw = vmulq_f32(rw, vrecpsq_f32(cw, rw));
+    rw = vmulq_f32(rw, vrecpsq_f32(cw, rw));
+
+    float32x4x3_t res = { { vmulq_f32(cx, rw), vmulq_f32(cy, rw), vmulq_f32(cz, rw) } };
+    vst3q_f32(&out[i].x, res);
+  }
+#endif
+
+  for (; i < n; i++) {
+    const float *p = in + i*dims;
+    f4 clip = f4x4_mul_f4(m, (f4) { { p[0], p[1], (dims == 3) ? p[2] : 0.0f, 1.0f } });
+    if (outside) outside[i] = math_outcode(clip);
+    out[i] = (f3) { clip.p.x / clip.p.w, clip.p.y / clip.p.w, clip.p.z / clip.p.w };
+  }
+}
+
+/* f4x4_transform_f3 on every point in "in"; in and out can be the same.
+ * If outside isn't NULL, it gets n math_OUTSIDE_* masks */
+static void f4x4_transform_f3_array(f4x4 m, const f3 *in, f3 *out, uint8_t *outside, size_t n) {
+  math_transform_array(m, &in->x, 3, out, outside, n);
+}
+
+/* the same, for points on the z = 0 plane (put them elsewhere with m) */
+static void f4x4_transform_f2_array(f4x4 m, const f2 *in, f3 *out, uint8_t *outside, size_t n) {
+  math_transform_array(m, &in->x, 2, out, outside, n);
+}
+
 static f4x4 f4x4_scale(float scale) {
   f4x4 res = {0};
   res.arr[0][0] = scale;
@@ -0,0 +1,446 @@
+// vim: sw=2 ts=2 expandtab smartindent
+#ifndef nav_IMPLEMENTATION
+
+/* A flow field over the playable area that points everywhere towards the
+ * player, so anyone (enemies, mostly) can find their way by looking up the
+ * cell they're in with nav_flow, however many of them there are.
+ *
+ * It's a grid over the terrain's collision loop, with cells off the terrain
+ * or too close to a CAD wall blocked. Each cell knows how far it is from
+ * the goal's cell and which neighbour is next on the way there (8 ways,
+ * without cutting corners), which is to say it's the shortest paths tree
+ * grown out of the goal's cell.
+ *
+ * The whole grid is only searched again when the goal moves to another
+ * cell. When walls come and go, the cells whose way went through anywhere
+ * that changed are cleared, and the search picks back up from around the
+ * edges of what was cleared; that also gets to anywhere that opened up,
+ * and carries on from there for as long as it finds shortcuts. */
+
+#define nav_CELL 0.5f
+/* cells closer than this to a wall or the terrain's edge are blocked
+ * (about half of someone, plus half a wall) */
+#define nav_CLEARANCE 0.4f
+
+/* what a step to a neighbour costs, straight and diagonally (about 1 : sqrt 2) */
+#define nav_COST_STRAIGHT 5
+#define nav_COST_DIAGONAL 7
+
+#define nav_FAR UINT32_MAX
+#define nav_DIR_NONE 8
+
+/* nav_State.flags */
+#define nav_OUTSIDE (1 << 0) /* off the terrain, blocked for good */
+#define nav_DIRTY   (1 << 1) /* in nav_State.dirty */
+#define nav_CLEARED (1 << 2) /* in nav_State.cleared, during a search */
+#define nav_SEEDED  (1 << 3) /* in nav_State.seeds, during a search */
+
+typedef struct {
+  uint32_t *cells;
+  size_t count, cap;
+} nav_Bucket;
+
+typedef struct {
+  /* cell (0, 0)'s corner is at min */
+  f2 min;
+  int32_t size_x, size_y;
+
+  /* for every cell */
+  uint16_t *walls; /* how many walls block it */
+  uint8_t  *flags;
+  uint32_t *dist;  /* to the goal, in nav_COST_*s; nav_FAR if there's no way */
+  uint8_t  *dir;   /* the neighbour to go to next; nav_DIR_NONE at the goal or if there's no way */
+
+  /* the cells that were blocked or unblocked since the last nav_frame */
+  uint32_t *dirty;
+  size_t dirty_count;
+
+  /* where the search goes from: the goal's cell (or -1 for nowhere) */
+  int32_t goal;
+
+  /* scratch for the searches; the queue is bucketed by dist, and only ever
+   * holds dists up to nav_COST_DIAGONAL past the one being looked at */
+  uint32_t *cleared, *seeds;
+  nav_Bucket buckets[nav_COST_DIAGONAL + 1];
+  size_t queued;
+
+  bool debug_draw;
+} nav_State;
+
+/* before any walls go up (so before cad_init) */
+static void nav_init(void);
+static void nav_frame(void);
+/* a wall from a to b was put up (or taken down); see cad_grid_wall */
+static void nav_wall(f2 a, f2 b, bool insert);
+
+/* which way to go from pos towards the goal (a unit vector), or zero
+ * if already there or if there's no way */
+static UNUSED_FN f2 nav_flow(f2 pos);
+/* how far pos is from the goal going around things, or INFINITY if there's no way */
+static UNUSED_FN float nav_distance(f2 pos);
+#endif
+
+#ifdef nav_IMPLEMENTATION
+
+/* the edge of the terrain, from collision/blender_export.py */
+static const f3 nav_terrain[] =
+#include "../collision/IntroGravestoneTerrain.h"
+;
+
+/* straight ones are even, diagonal ones odd; the opposite of d is (d + 4) % 8 */
+static const int8_t nav_dirs[8][2] = {
+  { 1, 0 }, { 1, 1 }, { 0, 1 }, { -1, 1 }, { -1, 0 }, { -1, -1 }, { 0, -1 }, { 1, -1 },
+};
+
+static int32_t nav_cell(f2 p) {
+  nav_State *nav = &jeux.sim.nav;
+  int32_t x = (int32_t)floorf((p.x - nav->min.x) / nav_CELL);
+  int32_t y = (int32_t)floorf((p.y - nav->min.y) / nav_CELL);
+  if (nav->dist == NULL || x < 0 || y < 0 || x >= nav->size_x || y >= nav->size_y) return -1;
+  return y*nav->size_x + x;
+}
+
+static f2 nav_cell_center(uint32_t c) {
+  nav_State *nav = &jeux.sim.nav;
+  return (f2) {
+    nav->min.x + ((c % nav->size_x) + 0.5f)*nav_CELL,
+    nav->min.y + ((c / nav->size_x) + 0.5f)*nav_CELL,
+  };
+}
+
+/* the cell next to c in direction d, or -1 if that's off the grid */
+static int32_t nav_neighbour(uint32_t c, int d) {
+  nav_State *nav = &jeux.sim.nav;
+  int32_t x = (c % nav->size_x) + nav_dirs[d][0];
+  int32_t y = (c / nav->size_x) + nav_dirs[d][1];
+  if (x < 0 || y < 0 || x >= nav->size_x || y >= nav->size_y) return -1;
+  return y*nav->size_x + x;
+}
+
+static bool nav_open(int32_t c) {
+  nav_State *nav = &jeux.sim.nav;
+  return c >= 0 && !(nav->flags[c] & nav_OUTSIDE) && nav->walls[c] == 0;
+}
+
+/* the cell a step from c in direction d gets to, or -1 if it's blocked
+ * (a diagonal step can't squeeze between two blocked cells either) */
+static int32_t nav_step(uint32_t c, int d) {
+  int32_t to = nav_neighbour(c, d);
+  if (!nav_open(to)) return -1;
+  if ((d & 1) && !(nav_open(nav_neighbour(c, (d + 7) % 8)) && nav_open(nav_neighbour(c, (d + 1) % 8)))) return -1;
+  return to;
+}
+
+/* whether c's step towards the goal goes to p, or (if corners) squeezes past it */
+static bool nav_steps_by(uint32_t c, uint32_t p, bool corners) {
+  uint8_t d = jeux.sim.nav.dir[c];
+  if (d == nav_DIR_NONE) return false;
+  if (nav_neighbour(c, d) == (int32_t)p) return true;
+  return corners && (d & 1) && (nav_neighbour(c, (d + 7) % 8) == (int32_t)p ||
+                                nav_neighbour(c, (d + 1) % 8) == (int32_t)p);
+}
+
+/* MARK: search { */
+
+static void nav_push(uint32_t c) {
+  nav_State *nav = &jeux.sim.nav;
+  nav_Bucket *bucket = nav->buckets + nav->dist[c] % jx_COUNT(nav->buckets);
+  if (bucket->count == bucket->cap) {
+    size_t cap = bucket->cap ? bucket->cap*2 : 1024;
+    uint32_t *cells = SDL_realloc(bucket->cells, cap*sizeof(uint32_t));
+    if (cells == NULL) {
+      log_error("nav: out of memory");
+      return;
+    }
+    bucket->cells = cells;
+    bucket->cap = cap;
+  }
+  bucket->cells[bucket->count++] = c;
+  nav->queued++;
+}
+
+static void nav_relax(uint32_t c) {
+  nav_State *nav = &jeux.sim.nav;
+  for (int d = 0; d < 8; d++) {
+    int32_t to = nav_step(c, d);
+    if (to < 0) continue;
+
+    uint32_t dist = nav->dist[c] + ((d & 1) ? nav_COST_DIAGONAL : nav_COST_STRAIGHT);
+    if (dist < nav->dist[to]) {
+      nav->dist[to] = dist;
+      nav->dir[to] = (d + 4) % 8;
+      nav_push(to);
+    }
+  }
+}
+
+static int nav_seed_cmp(const void *a, const void *b) {
+  uint32_t da = jeux.sim.nav.dist[*(const uint32_t *)a];
+  uint32_t db = jeux.sim.nav.dist[*(const uint32_t *)b];
+  return (da > db) - (da < db);
+}
+
+/* grows the tree out of nav->seeds for as long as it finds anything shorter
+ * (Dijkstra, with a bucket per dist since the steps cost so little) */
+static void nav_grow(size_t seed_count) {
+  nav_State *nav = &jeux.sim.nav;
+  if (seed_count == 0) return;
+  SDL_qsort(nav->seeds, seed_count, sizeof(uint32_t), nav_seed_cmp);
+
+  size_t next_seed = 0;
+  uint32_t dist = nav->dist[nav->seeds[0]];
+  while (nav->queued > 0 || next_seed < seed_count) {
+    /* nothing in the queue until the next seed's dist */
+    if (nav->queued == 0 && nav->dist[nav->seeds[next_seed]] > dist) dist = nav->dist[nav->seeds[next_seed]];
+    /* (a seed something shorter's been found for since is already queued at that) */
+    for (; next_seed < seed_count && nav->dist[nav->seeds[next_seed]] <= dist; next_seed++)
+      if (nav->dist[nav->seeds[next_seed]] == dist) nav_push(nav->seeds[next_seed]);
+
+    /* steps never cost 0, so nothing gets added to this bucket while it's gone through */
+    nav_Bucket *bucket = nav->buckets + dist % jx_COUNT(nav->buckets);
+    for (size_t i = 0; i < bucket->count; i++)
+      if (nav->dist[bucket->cells[i]] == dist) nav_relax(bucket->cells[i]);
+    nav->queued -= bucket->count;
+    bucket->count = 0;
+    dist++;
+  }
+}
+
+static void nav_search_all(void) {
+  nav_State *nav = &jeux.sim.nav;
+  size_t cell_count = (size_t)nav->size_x*nav->size_y;
+  for (size_t c = 0; c < cell_count; c++) {
+    nav->dist[c] = nav_FAR;
+    nav->dir[c] = nav_DIR_NONE;
+    nav->flags[c] &= ~nav_DIRTY;
+  }
+  nav->dirty_count = 0;
+
+  if (nav->goal < 0) return;
+  nav->dist[nav->goal] = 0;
+  nav->seeds[0] = nav->goal;
+  nav_grow(1);
+}
+
+static void nav_clear(uint32_t c, size_t *cleared_count) {
+  nav_State *nav = &jeux.sim.nav;
+  if (nav->flags[c] & nav_CLEARED) return;
+  nav->flags[c] |= nav_CLEARED;
+  nav->dist[c] = nav_FAR;
+  nav->dir[c] = nav_DIR_NONE;
+  nav->cleared[(*cleared_count)++] = c;
+}
+
+/* redoes only what the dirty cells could have changed (the goal's isn't one) */
+static void nav_search_dirty(void) {
+  nav_State *nav = &jeux.sim.nav;
+  size_t cleared_count = 0;
+
+  /* everything whose way goes through (or past the corner of) a dirty cell,
+   * and the dirty cells themselves since they might've just opened up */
+  for (size_t i = 0; i < nav->dirty_count; i++) {
+    uint32_t p = nav->dirty[i];
+    nav->flags[p] &= ~nav_DIRTY;
+    for (int d = 0; d < 8; d++) {
+      int32_t c = nav_neighbour(p, d);
+      if (c >= 0 && nav_steps_by(c, p, true)) nav_clear(c, &cleared_count);
+    }
+    nav_clear(p, &cleared_count);
+  }
+  nav->dirty_count = 0;
+
+  /* ... and everything whose way went through those */
+  for (size_t i = 0; i < cleared_count; i++)
+    for (int d = 0; d < 8; d++) {
+      int32_t c = nav_neighbour(nav->cleared[i], d);
+      if (c >= 0 && !(nav->flags[c] & nav_CLEARED) && nav_steps_by(c, nav->cleared[i], false))
+        nav_clear(c, &cleared_count);
+    }
+
+  /* start again from whatever still has a way, around the edges */
+  size_t seed_count = 0;
+  for (size_t i = 0; i < cleared_count; i++)
+    for (int d = 0; d < 8; d++) {
+      int32_t c = nav_neighbour(nav->cleared[i], d);
+      if (c < 0 || (nav->flags[c] & (nav_CLEARED | nav_SEEDED)) || nav->dist[c] == nav_FAR) continue;
+      nav->flags[c] |= nav_SEEDED;
+      nav->seeds[seed_count++] = c;
+    }
+
+  for (size_t i = 0; i < cleared_count; i++) nav->flags[nav->cleared[i]] &= ~nav_CLEARED;
+  for (size_t i = 0; i < seed_count;    i++) nav->flags[nav->seeds  [i]] &= ~nav_SEEDED;
+
+  nav_grow(seed_count);
+}
+
+/* } MARK */
+
+/* adds delta to the walls on every cell within nav_CLEARANCE of a b,
+ * or, if delta is 0, takes them off the terrain for good */
+static void nav_segment(f2 a, f2 b, int delta) {
+  nav_State *nav = &jeux.sim.nav;
+  int32_t x0 = (int32_t)floorf((fminf(a.x, b.x) - nav_CLEARANCE - nav->min.x) / nav_CELL);
+  int32_t y0 = (int32_t)floorf((fminf(a.y, b.y) - nav_CLEARANCE - nav->min.y) / nav_CELL);
+  int32_t x1 = (int32_t)floorf((fmaxf(a.x, b.x) + nav_CLEARANCE - nav->min.x) / nav_CELL);
+  int32_t y1 = (int32_t)floorf((fmaxf(a.y, b.y) + nav_CLEARANCE - nav->min.y) / nav_CELL);
+  if (x0 < 0) x0 = 0;
+  if (y0 < 0) y0 = 0;
+  if (x1 >= nav->size_x) x1 = nav->size_x - 1;
+  if (y1 >= nav->size_y) y1 = nav->size_y - 1;
+
+  for (int32_t y = y0; y <= y1; y++)
+    for (int32_t x = x0; x <= x1; x++) {
+      uint32_t c = y*nav->size_x + x;
+      if (f2_segment_distance(nav_cell_center(c), a, b) > nav_CLEARANCE) continue;
+
+      if (delta == 0) {
+        nav->flags[c] |= nav_OUTSIDE;
+        continue;
+      }
+
+      bool was_open = nav->walls[c] == 0;
+      nav->walls[c] += delta;
+      bool is_open = nav->walls[c] == 0;
+      if (was_open != is_open && !(nav->flags[c] & (nav_OUTSIDE | nav_DIRTY))) {
+        nav->flags[c] |= nav_DIRTY;
+        nav->dirty[nav->dirty_count++] = c;
+      }
+    }
+}
+
+static void nav_wall(f2 a, f2 b, bool insert) {
+  if (jeux.sim.nav.dist == NULL) return;
+  nav_segment(a, b, insert ? 1 : -1);
+}
+
+static void nav_init(void) {
+  nav_State *nav = &jeux.sim.nav;
+  size_t vert_count = jx_COUNT(nav_terrain);
+
+  Box2 bounds = BOX2_CLOSED;
+  for (size_t i = 0; i < vert_count; i++) {
+    bounds.min.x = fminf(bounds.min.x, nav_terrain[i].x);
+    bounds.min.y = fminf(bounds.min.y, nav_terrain[i].y);
+    bounds.max.x = fmaxf(bounds.max.x, nav_terrain[i].x);
+    bounds.max.y = fmaxf(bounds.max.y, nav_terrain[i].y);
+  }
+
+  /* a cell of slack all the way around */
+  nav->min = (f2) { bounds.min.x - nav_CELL, bounds.min.y - nav_CELL };
+  nav->size_x = (int32_t)ceilf((bounds.max.x - bounds.min.x) / nav_CELL) + 2;
+  nav->size_y = (int32_t)ceilf((bounds.max.y - bounds.min.y) / nav_CELL) + 2;
+  nav->goal = -1;
+
+  size_t cell_count = (size_t)nav->size_x*nav->size_y;
+  nav->walls   = SDL_calloc(cell_count, sizeof(uint16_t));
+  nav->flags   = SDL_calloc(cell_count, sizeof(uint8_t));
+  nav->dist    = SDL_calloc(cell_count, sizeof(uint32_t));
+  nav->dir     = SDL_calloc(cell_count, sizeof(uint8_t));
+  nav->dirty   = SDL_calloc(cell_count, sizeof(uint32_t));
+  nav->cleared = SDL_calloc(cell_count, sizeof(uint32_t));
+  nav->seeds   = SDL_calloc(cell_count, sizeof(uint32_t));
+  if (!nav->walls || !nav->flags || !nav->dist || !nav->dir || !nav->dirty || !nav->cleared || !nav->seeds) {
+    log_error("nav: out of memory, nobody will find their way anywhere");
+    SDL_free(nav->walls);
+    SDL_free(nav->flags);
+    SDL_free(nav->dist);
+    SDL_free(nav->dir);
+    SDL_free(nav->dirty);
+    SDL_free(nav->cleared);
+    SDL_free(nav->seeds);
+    *nav = (nav_State) { .goal = -1 };
+    return;
+  }
+
+  /* off the terrain is outside the loop (even-odd), or too close to its edge */
+  for (size_t c = 0; c < cell_count; c++) {
+    f2 p = nav_cell_center(c);
+    bool inside = false;
+    for (size_t i = 0, j = vert_count - 1; i < vert_count; j = i++) {
+      f3 a = nav_terrain[i], b = nav_terrain[j];
+      if ((a.y > p.y) != (b.y > p.y) && p.x < (b.x - a.x)*(p.y - a.y)/(b.y - a.y) + a.x) inside = !inside;
+    }
+    if (!inside) nav->flags[c] |= nav_OUTSIDE;
+    nav->dist[c] = nav_FAR;
+    nav->dir[c] = nav_DIR_NONE;
+  }
+  for (size_t i = 0, j = vert_count - 1; i < vert_count; j = i++)
+    nav_segment((f2) { nav_terrain[i].x, nav_terrain[i].y }, (f2) { nav_terrain[j].x, nav_terrain[j].y }, 0);
+}
+
+static void nav_debug_draw(void);
+
+static void nav_frame(void) {
+  nav_State *nav = &jeux.sim.nav;
+  if (nav->dist == NULL) return;
+
+  int32_t goal = nav_cell(jeux.sim.characters.all[0].pos);
+  if (goal != nav->goal || (goal >= 0 && (nav->flags[goal] & nav_DIRTY))) {
+    nav->goal = goal;
+    nav_search_all();
+  } else if (nav->dirty_count > 0) {
+    nav_search_dirty();
+  }
+
+  if (nav->debug_draw) nav_debug_draw();
+}
+
+static UNUSED_FN f2 nav_flow(f2 pos) {
+  int32_t c = nav_cell(pos);
+  if (c < 0 || jeux.sim.nav.dir[c] == nav_DIR_NONE) return (f2) {0};
+
+  const int8_t *d = nav_dirs[jeux.sim.nav.dir[c]];
+  float scale = (d[0] && d[1]) ? 0.70710678f : 1.0f;
+  return (f2) { d[0]*scale, d[1]*scale };
+}
+
+static UNUSED_FN float nav_distance(f2 pos) {
+  int32_t c = nav_cell(pos);
+  if (c < 0 || jeux.sim.nav.dist[c] == nav_FAR) return INFINITY;
+  return jeux.sim.nav.dist[c] * (nav_CELL / nav_COST_STRAIGHT);
+}
+
+/* arrows for the cells around the mouse, and an x on the ones walls block */
+#define nav_DEBUG_RADIUS 6.0f
+static void nav_debug_draw(void) {
+  nav_State *nav = &jeux.sim.nav;
+  f2 mouse = { jeux.mouse_ground.x, jeux.mouse_ground.y };
+  int32_t reach = (int32_t)(nav_DEBUG_RADIUS / nav_CELL);
+
+  int32_t center = nav_cell(mouse);
+  if (center < 0) return;
+  int32_t cx = center % nav->size_x, cy = center / nav->size_x;
+
+  for (int32_t y = cy - reach; y <= cy + reach; y++)
+    for (int32_t x = cx - reach; x <= cx + reach; x++) {
+      if (x < 0 || y < 0 || x >= nav->size_x || y >= nav->size_y) continue;
+      uint32_t c = y*nav->size_x + x;
+      f2 p = nav_cell_center(c);
+
+      if (nav->walls[c] > 0 && !(nav->flags[c] & nav_OUTSIDE)) {
+        float r = nav_CELL*0.25f;
+        gl_geo_line(
+          jeux_world_to_screen((f3) { p.x - r, p.y - r, 0.01f }),
+          jeux_world_to_screen((f3) { p.x + r, p.y + r, 0.01f }),
+          1.0f, (Color) { 255, 60, 60, 255 }
+        );
+        gl_geo_line(
+          jeux_world_to_screen((f3) { p.x - r, p.y + r, 0.01f }),
+          jeux_world_to_screen((f3) { p.x + r, p.y - r, 0.01f }),
+          1.0f, (Color) { 255, 60, 60, 255 }
+        );
+        continue;
+      }
+
+      f2 flow = nav_flow(p);
+      if (flow.x == 0 && flow.y == 0) continue;
+      float r = nav_CELL*0.4f;
+      gl_geo_line(
+        jeux_world_to_screen((f3) { p.x,            p.y,            0.01f }),
+        jeux_world_to_screen((f3) { p.x + flow.x*r, p.y + flow.y*r, 0.01f }),
+        1.0f, (Color) { 80, 200, 255, 255 }
+      );
+    }
+}
+
+#endif
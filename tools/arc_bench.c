@@ -0,0 +1,107 @@
+// vim: sw=2 ts=2 expandtab smartindent
+
+/**
+ * times the point math of the arc emitters in src/gl.h: the old loop, which
+ * took a cosf/sinf pair for both ends of every segment, against the
+ * math_arc_walk/math_arc_step rotation they use now, and reports how far the
+ * rotated points drift from the exact ones
+ **/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <math.h>
+#include <time.h>
+
+/* what math.h expects the game to have defined before it */
+#define UNUSED_FN __attribute__((unused))
+#define log_warn(...) (fprintf(stderr, __VA_ARGS__), fputc('\n', stderr))
+#include "../src/math.h"
+
+#define RADIUS 100.0f
+#define BENCH_COUNT 1000000
+/* the ring emitters never go past gl_geo_DETAIL_MAX */
+#define DETAIL_MAX 128
+
+/* both write the detail + 1 points of an arc the way gl_geo_ring2_arc gets them,
+ * two per segment */
+static void arc_old(f2 *out, float radians_from, float radians_to, int detail) {
+  for (int i = 0; i < detail; i++) {
+    float t0 = lerp(radians_from, radians_to, (float)i / (float)detail);
+    out[i] = (f2) { cosf(t0) * RADIUS, sinf(t0) * RADIUS };
+
+    float t1 = lerp(radians_from, radians_to, (float)(i + 1) / (float)detail);
+    out[i + 1] = (f2) { cosf(t1) * RADIUS, sinf(t1) * RADIUS };
+  }
+}
+
+static void arc_new(f2 *out, float radians_from, float radians_to, int detail) {
+  math_ArcWalk walk = math_arc_walk(radians_from, radians_to, detail);
+  out[0] = (f2) { walk.p.x * RADIUS, walk.p.y * RADIUS };
+  for (int i = 0; i < detail; i++) {
+    math_arc_step(&walk);
+    out[i + 1] = (f2) { walk.p.x * RADIUS, walk.p.y * RADIUS };
+  }
+}
+
+/* furthest any point of the rotated arc gets from where it should be */
+static double drift(float radians_from, float radians_to, int detail) {
+  f2 pts[DETAIL_MAX + 1];
+  arc_new(pts, radians_from, radians_to, detail);
+
+  double worst = 0.0;
+  for (int i = 0; i <= detail; i++) {
+    double t = radians_from + (radians_to - radians_from) * ((double)i / detail);
+    double dx = pts[i].x - cos(t) * RADIUS, dy = pts[i].y - sin(t) * RADIUS;
+    worst = fmax(worst, sqrt(dx*dx + dy*dy));
+  }
+  return worst;
+}
+
+static double seconds(void) { return (double)clock() / CLOCKS_PER_SEC; }
+
+int main(void) {
+  static f2 pts[DETAIL_MAX + 1];
+  /* a sink for the results, so nothing gets skipped */
+  volatile float sink = 0.0f;
+
+  printf("quarter arcs at radius %g, ns per arc\n", RADIUS);
+  printf("%-8s %12s %12s %16s\n", "detail", "cosf/sinf", "rotation", "worst drift");
+
+  const int details[] = { 16, 32 };
+  for (size_t d = 0; d < sizeof(details) / sizeof(*details); d++) {
+    int detail = details[d];
+
+    /* the border arcs start at arbitrary angles, so vary it */
+    double t = seconds();
+    for (int i = 0; i < BENCH_COUNT; i++) {
+      float from = (float)(i & 1023) * 0.01f;
+      arc_old(pts, from, from + M_PI*0.5f, detail);
+      sink += pts[i % (detail + 1)].x;
+    }
+    double old = seconds() - t;
+
+    t = seconds();
+    for (int i = 0; i < BENCH_COUNT; i++) {
+      float from = (float)(i & 1023) * 0.01f;
+      arc_new(pts, from, from + M_PI*0.5f, detail);
+      sink += pts[i % (detail + 1)].x;
+    }
+    double new = seconds() - t;
+
+    double worst = 0.0;
+    for (int i = 0; i < 1024; i++) {
+      float from = (float)i * 0.01f;
+      worst = fmax(worst, drift(from, from + M_PI*0.5f, detail));
+    }
+
+    printf("%-8d %12.1f %12.1f %16g\n", detail, old*1e9/BENCH_COUNT, new*1e9/BENCH_COUNT, worst);
+  }
+
+  /* gl_geo_ring3 walks the whole way round, which is where it drifts most */
+  printf("\nfull ring at detail %d, worst drift %g\n", DETAIL_MAX, drift(0.0f, M_PI*2.0f, DETAIL_MAX));
+
+  return 0;
+}
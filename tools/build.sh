@@ -0,0 +1,10 @@
+mkdir -p build
+cd build
+gcc ../math_check.c -O2 -g -Werror -c -o math_check_simd.o || { exit 1; }
+gcc ../math_check.c -O2 -g -Werror -c -Dmath_NO_SIMD -o math_check_scalar.o || { exit 1; }
+gcc math_check_simd.o math_check_scalar.o -o math_check -lm || { exit 1; }
+gcc ../arc_bench.c -O3 -g -Werror -o arc_bench -lm || { exit 1; }
+cd ..
+./build/math_check || { exit 1; }
+echo
+./build/arc_bench
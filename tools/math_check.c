@@ -0,0 +1,160 @@
+// vim: sw=2 ts=2 expandtab smartindent
+
+/**
+ * checks the SIMD f4x4 paths in src/math.h against the plain C ones on
+ * random matrices, and times both. build.sh compiles this file twice, once
+ * with -Dmath_NO_SIMD, and links the two together: each build wraps its
+ * own math.h in functions with its own prefix, and the SIMD one has main
+ **/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <math.h>
+#include <time.h>
+
+/* what math.h expects the game to have defined before it */
+#define UNUSED_FN __attribute__((unused))
+#define log_warn(...) (fprintf(stderr, __VA_ARGS__), fputc('\n', stderr))
+#include "../src/math.h"
+
+/* relative to the largest magnitude in what's compared */
+#define TOLERANCE 1e-4f
+#define CHECK_COUNT 100000
+#define BENCH_COUNT 10000000
+#define ARRAY_COUNT 1024
+
+#ifdef math_NO_SIMD
+  #define PATH(name) scalar_##name
+#else
+  #define PATH(name) simd_##name
+#endif
+
+f4x4 PATH(mul)(f4x4 a, f4x4 b) { return f4x4_mul_f4x4(a, b); }
+f4x4 PATH(mul_affine)(f4x4 a, f4x4 b) { return f4x4_mul_affine(a, b); }
+f4 PATH(mul_f4)(f4x4 m, f4 v) { return f4x4_mul_f4(m, v); }
+f3 PATH(transform)(f4x4 m, f3 v) { return f4x4_transform_f3(m, v); }
+f4x4 PATH(invert)(f4x4 m) { return f4x4_invert(m); }
+void PATH(transform_array)(f4x4 m, const f3 *in, f3 *out, uint8_t *outside, size_t n) {
+  f4x4_transform_f3_array(m, in, out, outside, n);
+}
+
+#ifndef math_NO_SIMD
+
+f4x4 scalar_mul(f4x4 a, f4x4 b);
+f4x4 scalar_mul_affine(f4x4 a, f4x4 b);
+f4 scalar_mul_f4(f4x4 m, f4 v);
+f3 scalar_transform(f4x4 m, f3 v);
+f4x4 scalar_invert(f4x4 m);
+void scalar_transform_array(f4x4 m, const f3 *in, f3 *out, uint8_t *outside, size_t n);
+
+static float rand_float(void) { return (float)rand() / (float)RAND_MAX * 2.0f - 1.0f; }
+
+/* a turn, a move and a scale; the bottom row stays 0 0 0 1 */
+static f4x4 rand_affine(void) {
+  f4x4 m = f4x4_mul_affine(f4x4_turn(rand_float()*3.0f), f4x4_move((f3) { rand_float()*10, rand_float()*10, rand_float()*10 }));
+  return f4x4_mul_affine(m, f4x4_scale(1.0f + rand_float()*0.5f));
+}
+
+/* well enough conditioned to invert: an affine one, sometimes with a perspective */
+static f4x4 rand_matrix(void) {
+  f4x4 m = rand_affine();
+  if (rand() % 2) m = f4x4_mul_f4x4(m, f4x4_perspective(1.0f + rand_float()*0.5f, 1.5f, 0.1f, 100.0f));
+  return m;
+}
+
+/* the largest difference, relative to the largest magnitude */
+static float compare(const float *a, const float *b, size_t n) {
+  float diff = 0.0f, size = 1.0f;
+  for (size_t i = 0; i < n; i++) {
+    diff = fmaxf(diff, fabsf(a[i] - b[i]));
+    size = fmaxf(size, fmaxf(fabsf(a[i]), fabsf(b[i])));
+  }
+  return diff / size;
+}
+
+static double seconds(void) { return (double)clock() / CLOCKS_PER_SEC; }
+
+int main(void) {
+#if math_SSE2
+  printf("SIMD build is SSE2\n");
+#elif math_NEON
+  printf("SIMD build is NEON\n");
+#else
+  printf("SIMD build has no SIMD (this target has neither SSE2 nor NEON)\n");
+#endif
+
+  float worst[6] = {0};
+  int outside_mismatches = 0;
+  static f3 points[ARRAY_COUNT], simd_out[ARRAY_COUNT], scalar_out[ARRAY_COUNT];
+  static uint8_t simd_outside[ARRAY_COUNT], scalar_outside[ARRAY_COUNT];
+
+  for (int i = 0; i < CHECK_COUNT; i++) {
+    f4x4 a = rand_matrix(), b = rand_matrix(), c = rand_affine();
+    f4 v = { { rand_float()*10, rand_float()*10, rand_float()*10, 1.0f } };
+
+    f4x4 m0 = simd_mul(a, b), m1 = scalar_mul(a, b);
+    worst[0] = fmaxf(worst[0], compare(m0.floats, m1.floats, 16));
+    f4x4 f0 = simd_mul_affine(a, c), f1 = scalar_mul_affine(a, c);
+    worst[5] = fmaxf(worst[5], compare(f0.floats, f1.floats, 16));
+    f4 v0 = simd_mul_f4(a, v), v1 = scalar_mul_f4(a, v);
+    worst[1] = fmaxf(worst[1], compare(v0.arr, v1.arr, 4));
+    f3 t0 = simd_transform(a, v.xyz), t1 = scalar_transform(a, v.xyz);
+    worst[2] = fmaxf(worst[2], compare(&t0.x, &t1.x, 3));
+    f4x4 i0 = simd_invert(a), i1 = scalar_invert(a);
+    worst[3] = fmaxf(worst[3], compare(i0.floats, i1.floats, 16));
+
+    if (i % 100 == 0) {
+      for (int p = 0; p < ARRAY_COUNT; p++) points[p] = (f3) { rand_float()*10, rand_float()*10, rand_float()*10 };
+      simd_transform_array(a, points, simd_out, simd_outside, ARRAY_COUNT);
+      scalar_transform_array(a, points, scalar_out, scalar_outside, ARRAY_COUNT);
+      worst[4] = fmaxf(worst[4], compare(&simd_out->x, &scalar_out->x, ARRAY_COUNT*3));
+      for (int p = 0; p < ARRAY_COUNT; p++) outside_mismatches += simd_outside[p] != scalar_outside[p];
+    }
+  }
+
+  const char *names[6] = { "mul", "mul_f4", "transform", "invert", "transform_array", "mul_affine" };
+  int failed = 0;
+  for (int i = 0; i < 6; i++) {
+    printf("%-16s worst difference %g %s\n", names[i], worst[i], worst[i] <= TOLERANCE ? "ok" : "FAILED");
+    failed |= worst[i] > TOLERANCE;
+  }
+  /* points right on a clip plane can land either side of it */
+  printf("%-16s %d outside masks differ (of %d)\n", "", outside_mismatches, CHECK_COUNT / 100 * ARRAY_COUNT);
+
+  /* a sink for the results, so nothing gets skipped */
+  volatile float sink = 0.0f;
+  f4x4 a = rand_matrix(), b = rand_matrix(), c = rand_affine();
+  f4 v = { { 1.0f, 2.0f, 3.0f, 1.0f } };
+  double t;
+
+  printf("\n%-16s %12s %12s\n", "ns per call", "SIMD", "scalar");
+#define BENCH(name, call) do {                                                  \
+    double simd, scalar;                                                        \
+    t = seconds(); for (int i = 0; i < BENCH_COUNT; i++) sink += simd_##call;   \
+    simd = seconds() - t;                                                       \
+    t = seconds(); for (int i = 0; i < BENCH_COUNT; i++) sink += scalar_##call; \
+    scalar = seconds() - t;                                                     \
+    printf("%-16s %12.2f %12.2f\n", name, simd*1e9/BENCH_COUNT, scalar*1e9/BENCH_COUNT); \
+  } while (0)
+  BENCH("mul", mul(a, b).floats[i & 15]);
+  BENCH("mul_affine", mul_affine(a, c).floats[i & 15]);
+  BENCH("mul_f4", mul_f4(a, v).arr[i & 3]);
+  BENCH("transform", transform(a, v.xyz).x);
+  BENCH("invert", invert(a).floats[i & 15]);
+
+  double simd, scalar;
+  t = seconds();
+  for (int i = 0; i < BENCH_COUNT / ARRAY_COUNT; i++) simd_transform_array(a, points, simd_out, simd_outside, ARRAY_COUNT);
+  simd = seconds() - t;
+  t = seconds();
+  for (int i = 0; i < BENCH_COUNT / ARRAY_COUNT; i++) scalar_transform_array(a, points, scalar_out, scalar_outside, ARRAY_COUNT);
+  scalar = seconds() - t;
+  printf("%-16s %12.2f %12.2f  (per point)\n", "transform_array", simd*1e9/BENCH_COUNT, scalar*1e9/BENCH_COUNT);
+
+  return failed;
+}
+
+#endif